@@ -0,0 +1,78 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+/*
+ * Short-lived actors churn: an actor is spawned, started and immediately
+ * shut down (i.e. like one actor per request), in rounds of the specified
+ * amount of actors (1000 by default); the amount of rounds is the second
+ * argument (100 by default). If the third argument is "pool", then
+ * the actors are pool-allocated and the supervisor recycles their memory.
+ */
+
+#include "rotor.hpp"
+#include "loopless_supervisor.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+namespace r = rotor;
+
+struct child_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void on_start() noexcept override {
+        r::actor_base_t::on_start();
+        do_shutdown();
+    }
+};
+
+struct pooled_child_t : public child_t, r::pool_allocated_t {
+    using child_t::child_t;
+};
+
+using steady_t = std::chrono::steady_clock;
+
+int main(int argc, char **argv) {
+    std::size_t count = 1000;
+    std::size_t rounds = 100;
+    if (argc > 1) {
+        count = static_cast<std::size_t>(std::atoll(argv[1]));
+    }
+    if (argc > 2) {
+        rounds = static_cast<std::size_t>(std::atoll(argv[2]));
+    }
+    bool pool = argc > 3 && std::strcmp(argv[3], "pool") == 0;
+
+    r::system_context_t ctx{};
+    auto timeout = r::pt::minutes{1}; /* does not matter */
+    auto sup = ctx.create_supervisor<loopless_supervisor_t>().pool(pool).timeout(timeout).finish();
+    sup->do_process();
+
+    auto start = steady_t::now();
+    for (std::size_t i = 0; i < rounds; ++i) {
+        for (std::size_t j = 0; j < count; ++j) {
+            if (pool) {
+                sup->create_actor<pooled_child_t>().timeout(timeout).finish();
+            } else {
+                sup->create_actor<child_t>().timeout(timeout).finish();
+            }
+        }
+        sup->do_process();
+    }
+    std::chrono::duration<double> diff = steady_t::now() - start;
+
+    auto total = count * rounds;
+    double rate = static_cast<double>(total) / diff.count();
+    std::cout << "churn " << total << " actors (pool: " << (pool ? "yes" : "no") << ") in " << std::fixed
+              << std::setprecision(3) << diff.count() << "s, rate = " << std::setprecision(1) << rate
+              << " actors/s\n";
+
+    sup->do_shutdown();
+    sup->do_process();
+    return sup->finished ? 0 : 1;
+}
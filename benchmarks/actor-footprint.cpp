@@ -0,0 +1,66 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+/*
+ * Measures per-actor memory footprint: the specified amount of child
+ * actors (10k by default) is spawned and started on a single supervisor,
+ * and the amount of live heap memory is compared before and after. All heap
+ * allocations, caused by an actor, are taken into account, i.e. the actor
+ * itself, its plugins, address, subscriptions and supervisor's housekeeping.
+ *
+ * The default actor (`actor_base_t`) and the low-footprint one (`minimal_actor_t`)
+ * are measured.
+ */
+
+#include "rotor.hpp"
+#include "loopless_supervisor.h"
+#include "allocations.h"
+#include <cstdlib>
+#include <iostream>
+
+namespace r = rotor;
+
+struct default_child_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+};
+
+struct minimal_child_t : public r::minimal_actor_t {
+    using r::minimal_actor_t::minimal_actor_t;
+};
+
+template <typename Actor> static bool measure(const char *name, std::size_t count) {
+    r::system_context_t ctx{};
+    auto timeout = r::pt::minutes{1}; /* does not matter */
+    auto sup = ctx.create_supervisor<loopless_supervisor_t>().timeout(timeout).finish();
+    sup->do_process();
+
+    rotor::test::allocations_phase_t phase;
+    for (std::size_t i = 0; i < count; ++i) {
+        sup->create_actor<Actor>().timeout(timeout).finish();
+    }
+    sup->do_process();
+    auto allocations = phase.get();
+    auto bytes = static_cast<double>(allocations.live_bytes()) / count;
+    auto blocks = static_cast<double>(allocations.live_blocks()) / count;
+
+    std::cout << name << ": sizeof = " << sizeof(Actor) << " bytes, per actor heap = " << bytes << " bytes in "
+              << blocks << " blocks\n";
+
+    sup->do_shutdown();
+    sup->do_process();
+    return sup->finished;
+}
+
+int main(int argc, char **argv) {
+    std::size_t count = 10000;
+    if (argc > 1) {
+        count = static_cast<std::size_t>(std::atoll(argv[1]));
+    }
+
+    bool ok = measure<default_child_t>("actor_base_t", count);
+    ok = measure<minimal_child_t>("minimal_actor_t", count) && ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,117 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+/*
+ * Messages dispatching cost with different local delivery implementations:
+ * plain `local_delivery_t` (default in release builds), `inspected_local_delivery_t`
+ * (default in debug builds) and the former inspected delivery, which queried
+ * the environment upon each message. The actor sends the specified amount
+ * of messages (10M by default) to itself.
+ */
+
+#include "rotor.hpp"
+#include "loopless_supervisor.h"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+namespace r = rotor;
+
+struct ping_t {};
+
+/* the former per-message environment check */
+struct getenv_local_delivery_t {
+    static void delivery(r::message_ptr_t &message,
+                         const r::subscription_t::joint_handlers_t &local_recipients) noexcept {
+        auto var = std::getenv("ROTOR_INSPECT_DELIVERY");
+        if (var) {
+            auto dump = r::plugin::inspected_local_delivery_t::identify(message.get(), std::atoi(var));
+            if (dump.size() > 0) {
+                std::cout << ">> " << dump << " for " << message->address.get() << "\n";
+            }
+        }
+        r::plugin::local_delivery_t::delivery(message, local_recipients);
+    }
+};
+
+template <typename LocalDelivery> struct supervisor_t : public loopless_supervisor_t {
+    // clang-format off
+    using plugins_list_t = std::tuple<
+        r::plugin::address_maker_plugin_t,
+        r::plugin::locality_plugin_t,
+        r::plugin::delivery_plugin_t<LocalDelivery>,
+        r::plugin::lifetime_plugin_t,
+        r::plugin::init_shutdown_plugin_t,
+        r::plugin::foreigners_support_plugin_t,
+        r::plugin::child_manager_plugin_t,
+        r::plugin::link_server_plugin_t,
+        r::plugin::link_client_plugin_t,
+        r::plugin::registry_plugin_t,
+        r::plugin::starter_plugin_t>;
+    // clang-format on
+
+    using loopless_supervisor_t::loopless_supervisor_t;
+};
+
+struct sender_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&sender_t::on_ping); });
+    }
+
+    void on_start() noexcept override {
+        r::actor_base_t::on_start();
+        send<ping_t>(address);
+    }
+
+    void on_ping(r::message_t<ping_t> &) noexcept {
+        if (++received < total) {
+            send<ping_t>(address);
+        }
+    }
+
+    std::size_t total = 0;
+    std::size_t received = 0;
+};
+
+using steady_t = std::chrono::steady_clock;
+
+template <typename LocalDelivery> static bool measure(const char *name, std::size_t count) {
+    r::system_context_t ctx{};
+    auto timeout = r::pt::minutes{1}; /* does not matter */
+    auto sup = ctx.create_supervisor<supervisor_t<LocalDelivery>>().timeout(timeout).finish();
+    auto sender = sup->template create_actor<sender_t>().timeout(timeout).finish();
+    sender->total = count;
+
+    auto start = steady_t::now();
+    sup->do_process();
+    std::chrono::duration<double> diff = steady_t::now() - start;
+
+    double rate = static_cast<double>(sender->received) / diff.count();
+    std::cout << std::setw(10) << name << ": " << sender->received << " messages in " << std::fixed
+              << std::setprecision(3) << diff.count() << "s, " << std::setprecision(1) << (1e9 / rate)
+              << " ns/message, rate = " << rate << " msg/s\n";
+
+    bool ok = sender->received == count;
+    sup->do_shutdown();
+    sup->do_process();
+    return ok && sup->finished;
+}
+
+int main(int argc, char **argv) {
+    std::size_t count = 10000000;
+    if (argc > 1) {
+        count = static_cast<std::size_t>(std::atoll(argv[1]));
+    }
+
+    bool ok = measure<r::plugin::local_delivery_t>("local", count);
+    ok = measure<r::plugin::inspected_local_delivery_t>("inspected", count) && ok;
+    ok = measure<getenv_local_delivery_t>("getenv", count) && ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,696 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+/*
+ * Classic actor frameworks workloads on each of the built backends:
+ *
+ * - ring: the token is passed along the ring of 503 actors (operation = hop)
+ * - skynet: the tree of actors, where each node spawns 10 children, and the leaves
+ *   report their numbers, which are summed up to the root (operation = spawned actor);
+ *   10k leaves by default, use `--scale=100` for the classic 1M
+ * - chameneos: chameneos-redux, 10 creatures meet at the mall (operation = meeting)
+ * - fork-join: the master sends a task to each of 64 workers and waits for all
+ *   results, round by round (operation = task)
+ * - mailbox: 16 senders flood a single receiver (operation = received message)
+ *
+ * The actors are spread among `--workers` root supervisors, each one running
+ * on its own thread (event loop). See `microbench.h` for the options.
+ */
+
+#include "rotor.hpp"
+#include "microbench.h"
+#include <cmath>
+#include <memory>
+#include <thread>
+
+#ifdef ROTOR_BENCH_THREAD
+#include "rotor/thread.hpp"
+#endif
+#ifdef ROTOR_BENCH_ASIO
+#include "rotor/asio.hpp"
+#endif
+#ifdef ROTOR_BENCH_EV
+#include "rotor/ev.hpp"
+#endif
+
+namespace r = rotor;
+
+namespace {
+
+auto timeout = r::pt::seconds{60};
+
+/* root supervisors, each one is running on its own thread */
+struct backend_base_t {
+    std::vector<r::supervisor_ptr_t> supervisors;
+
+    r::supervisor_t &get(std::size_t index) noexcept { return *supervisors[index % supervisors.size()]; }
+
+    /* thread-safe */
+    void shutdown() noexcept {
+        for (auto &sup : supervisors) {
+            sup->shutdown();
+        }
+    }
+};
+
+#ifdef ROTOR_BENCH_THREAD
+struct thread_backend_t : backend_base_t {
+    using context_ptr_t = r::intrusive_ptr_t<r::thread::system_context_thread_t>;
+    std::vector<context_ptr_t> contexts;
+
+    thread_backend_t(std::size_t workers) {
+        for (std::size_t i = 0; i < workers; ++i) {
+            auto ctx = context_ptr_t(new r::thread::system_context_thread_t());
+            supervisors.emplace_back(
+                ctx->create_supervisor<r::thread::supervisor_thread_t>().timeout(timeout).finish());
+            contexts.emplace_back(std::move(ctx));
+        }
+    }
+
+    ~thread_backend_t() {
+        supervisors.clear();
+        contexts.clear();
+    }
+
+    void run() {
+        std::vector<std::thread> threads;
+        for (auto &ctx : contexts) {
+            threads.emplace_back([ctx]() { ctx->run(); });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+};
+#endif
+
+#ifdef ROTOR_BENCH_ASIO
+struct asio_backend_t : backend_base_t {
+    using io_context_ptr_t = std::unique_ptr<boost::asio::io_context>;
+    std::vector<io_context_ptr_t> io_contexts;
+    std::vector<r::system_context_ptr_t> contexts;
+
+    asio_backend_t(std::size_t workers) {
+        namespace ra = r::asio;
+        for (std::size_t i = 0; i < workers; ++i) {
+            auto &io_ctx = *io_contexts.emplace_back(new boost::asio::io_context(1));
+            auto ctx = ra::system_context_asio_t::ptr_t{new ra::system_context_asio_t(io_ctx)};
+            auto strand = std::make_shared<boost::asio::io_context::strand>(io_ctx);
+            auto sup = ctx->create_supervisor<ra::supervisor_asio_t>()
+                           .strand(strand)
+                           .timeout(timeout)
+                           .guard_context(true)
+                           .finish();
+            sup->start();
+            supervisors.emplace_back(std::move(sup));
+            contexts.emplace_back(std::move(ctx));
+        }
+    }
+
+    ~asio_backend_t() {
+        supervisors.clear();
+        contexts.clear();
+        io_contexts.clear();
+    }
+
+    void run() {
+        std::vector<std::thread> threads;
+        for (auto &io_ctx : io_contexts) {
+            threads.emplace_back([ctx = io_ctx.get()]() { ctx->run(); });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+};
+#endif
+
+#ifdef ROTOR_BENCH_EV
+struct ev_backend_t : backend_base_t {
+    std::vector<struct ev_loop *> loops;
+    std::vector<r::system_context_ptr_t> contexts;
+
+    ev_backend_t(std::size_t workers) {
+        namespace rev = r::ev;
+        for (std::size_t i = 0; i < workers; ++i) {
+            auto loop = ev_loop_new(0);
+            auto ctx = rev::system_context_ptr_t{new rev::system_context_ev_t()};
+            auto sup = ctx->create_supervisor<rev::supervisor_ev_t>()
+                           .loop(loop)
+                           .loop_ownership(true)
+                           .timeout(timeout)
+                           .finish();
+            sup->start();
+            supervisors.emplace_back(std::move(sup));
+            contexts.emplace_back(std::move(ctx));
+            loops.emplace_back(loop);
+        }
+    }
+
+    ~ev_backend_t() {
+        supervisors.clear();
+        contexts.clear();
+    }
+
+    void run() {
+        std::vector<std::thread> threads;
+        for (auto loop : loops) {
+            threads.emplace_back([loop]() { ev_run(loop); });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+};
+#endif
+
+/* links to all participants (i.e. waits until they are operational on
+ * their supervisors), then kicks off the workload */
+struct coordinator_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::link_client_plugin_t>([&](auto &p) {
+            for (auto &addr : participants) {
+                p.link(addr, true);
+            }
+        });
+    }
+
+    void on_start() noexcept override {
+        r::actor_base_t::on_start();
+        state->start();
+        kick_off();
+    }
+
+    virtual void kick_off() noexcept = 0;
+
+    void complete(std::size_t operations) noexcept {
+        state->stop();
+        state->operations = operations;
+        backend->shutdown();
+    }
+
+    std::vector<r::address_ptr_t> participants;
+    bench::state_t *state = nullptr;
+    backend_base_t *backend = nullptr;
+};
+
+template <typename Coordinator, typename Backend>
+Coordinator &make_coordinator(Backend &backend, bench::state_t &state) {
+    auto coordinator = backend.get(0).template create_actor<Coordinator>().timeout(timeout).finish();
+    coordinator->state = &state;
+    coordinator->backend = &backend;
+    return *coordinator;
+}
+
+void verify(bool condition, const char *what) {
+    if (!condition) {
+        std::cerr << what << " failed\n";
+        std::abort();
+    }
+}
+
+/* ring */
+namespace ring {
+
+struct token_t {
+    std::size_t hops_left;
+};
+struct done_t {};
+
+struct member_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&member_t::on_token); });
+    }
+
+    void on_token(r::message_t<token_t> &message) noexcept {
+        auto hops_left = message.payload.hops_left;
+        if (hops_left) {
+            send<token_t>(next, hops_left - 1);
+        } else {
+            send<done_t>(coordinator);
+        }
+    }
+
+    r::address_ptr_t next;
+    r::address_ptr_t coordinator;
+};
+
+struct coordinator_t : public ::coordinator_t {
+    using ::coordinator_t::coordinator_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        ::coordinator_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&coordinator_t::on_done); });
+    }
+
+    void kick_off() noexcept override { send<token_t>(participants.front(), state->iterations); }
+
+    void on_done(r::message_t<done_t> &) noexcept { complete(state->iterations); }
+};
+
+template <typename Backend> void run(bench::state_t &state) {
+    const std::size_t size = 503;
+    Backend backend(state.workers);
+    auto &coordinator = make_coordinator<coordinator_t>(backend, state);
+    std::vector<r::intrusive_ptr_t<member_t>> members;
+    for (std::size_t i = 0; i < size; ++i) {
+        members.emplace_back(backend.get(i).template create_actor<member_t>().timeout(timeout).finish());
+    }
+    for (std::size_t i = 0; i < size; ++i) {
+        members[i]->next = members[(i + 1) % size]->get_address();
+        members[i]->coordinator = coordinator.get_address();
+        coordinator.participants.emplace_back(members[i]->get_address());
+    }
+    members.clear();
+    backend.run();
+    verify(state.operations == state.iterations, "ring");
+}
+
+} // namespace ring
+
+/* skynet */
+namespace skynet {
+
+struct spawn_t {};
+struct result_t {
+    std::uint64_t value;
+};
+
+struct node_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) {
+            p.subscribe_actor(&node_t::on_spawn);
+            p.subscribe_actor(&node_t::on_result);
+        });
+    }
+
+    void on_start() noexcept override {
+        r::actor_base_t::on_start();
+        if (autostart) {
+            spawn();
+        }
+    }
+
+    void on_spawn(r::message_t<spawn_t> &) noexcept { spawn(); }
+
+    void spawn() noexcept {
+        if (size == 1) {
+            send<result_t>(parent, offset);
+            finish();
+            return;
+        }
+        auto child_size = size / 10;
+        for (std::size_t i = 0; i < 10; ++i) {
+            auto child = supervisor->create_actor<node_t>().timeout(timeout).finish();
+            child->parent = address;
+            child->offset = offset + i * child_size;
+            child->size = child_size;
+            child->autostart = true;
+        }
+    }
+
+    void on_result(r::message_t<result_t> &message) noexcept {
+        sum += message.payload.value;
+        if (++received == 10) {
+            send<result_t>(parent, sum);
+            finish();
+        }
+    }
+
+    /* the pre-spawned nodes are linked by the coordinator, their shutdown would
+     * cause the coordinator shutdown too, so they live until supervisor shutdown */
+    void finish() noexcept {
+        if (autostart) {
+            do_shutdown();
+        }
+    }
+
+    r::address_ptr_t parent;
+    std::uint64_t offset = 0;
+    std::uint64_t size = 0;
+    std::uint64_t sum = 0;
+    std::size_t received = 0;
+    bool autostart = false;
+};
+
+struct coordinator_t : public ::coordinator_t {
+    using ::coordinator_t::coordinator_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        ::coordinator_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&coordinator_t::on_result); });
+    }
+
+    void kick_off() noexcept override {
+        for (auto &addr : participants) {
+            send<spawn_t>(addr);
+        }
+    }
+
+    void on_result(r::message_t<result_t> &message) noexcept {
+        sum += message.payload.value;
+        if (++received == participants.size()) {
+            complete(actors);
+        }
+    }
+
+    std::uint64_t sum = 0;
+    std::size_t received = 0;
+    std::size_t actors = 0;
+};
+
+template <typename Backend> void run(bench::state_t &state) {
+    auto depth = std::max<int>(1, static_cast<int>(std::lround(std::log10(state.iterations))));
+    std::uint64_t leaves = 1;
+    std::size_t actors = 0;
+    for (int i = 0; i < depth; ++i) {
+        leaves *= 10;
+        actors += leaves;
+    }
+
+    Backend backend(state.workers);
+    auto &coordinator = make_coordinator<coordinator_t>(backend, state);
+    coordinator.actors = actors;
+    auto child_size = leaves / 10;
+    for (std::size_t i = 0; i < 10; ++i) {
+        auto node = backend.get(i).template create_actor<node_t>().timeout(timeout).finish();
+        node->parent = coordinator.get_address();
+        node->offset = i * child_size;
+        node->size = child_size;
+        coordinator.participants.emplace_back(node->get_address());
+    }
+    backend.run();
+    verify(state.operations == actors, "skynet");
+    verify(coordinator.sum == leaves * (leaves - 1) / 2, "skynet sum");
+}
+
+} // namespace skynet
+
+/* chameneos-redux */
+namespace chameneos {
+
+enum class color_t { blue, red, yellow };
+
+color_t complement(color_t a, color_t b) noexcept {
+    if (a == b) {
+        return a;
+    }
+    if (a != color_t::blue && b != color_t::blue) {
+        return color_t::blue;
+    }
+    if (a != color_t::red && b != color_t::red) {
+        return color_t::red;
+    }
+    return color_t::yellow;
+}
+
+struct start_t {};
+struct stop_t {};
+struct visit_t {
+    r::address_ptr_t creature;
+    color_t color;
+};
+struct meet_t {
+    color_t color;
+};
+struct report_t {
+    std::size_t meetings;
+};
+
+struct creature_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) {
+            p.subscribe_actor(&creature_t::on_start_visits);
+            p.subscribe_actor(&creature_t::on_meet);
+            p.subscribe_actor(&creature_t::on_stop);
+        });
+    }
+
+    void on_start_visits(r::message_t<start_t> &) noexcept { visit(); }
+
+    void on_meet(r::message_t<meet_t> &message) noexcept {
+        color = complement(color, message.payload.color);
+        ++meetings;
+        visit();
+    }
+
+    void on_stop(r::message_t<stop_t> &) noexcept { send<report_t>(mall, meetings); }
+
+    void visit() noexcept { send<visit_t>(mall, address, color); }
+
+    r::address_ptr_t mall;
+    color_t color = color_t::blue;
+    std::size_t meetings = 0;
+};
+
+struct mall_t : public ::coordinator_t {
+    using ::coordinator_t::coordinator_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        ::coordinator_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) {
+            p.subscribe_actor(&mall_t::on_visit);
+            p.subscribe_actor(&mall_t::on_report);
+        });
+    }
+
+    void kick_off() noexcept override {
+        meetings_left = state->iterations;
+        for (auto &addr : participants) {
+            send<start_t>(addr);
+        }
+    }
+
+    void on_visit(r::message_t<visit_t> &message) noexcept {
+        auto &visitor = message.payload;
+        if (!meetings_left) {
+            send<stop_t>(visitor.creature);
+            if (waiting) {
+                send<stop_t>(waiting);
+                waiting.reset();
+            }
+            return;
+        }
+        if (!waiting) {
+            waiting = visitor.creature;
+            waiting_color = visitor.color;
+            return;
+        }
+        --meetings_left;
+        send<meet_t>(waiting, visitor.color);
+        send<meet_t>(visitor.creature, waiting_color);
+        waiting.reset();
+    }
+
+    void on_report(r::message_t<report_t> &message) noexcept {
+        meetings += message.payload.meetings;
+        if (++reported == participants.size()) {
+            complete(meetings / 2);
+        }
+    }
+
+    std::size_t meetings_left = 0;
+    r::address_ptr_t waiting;
+    color_t waiting_color = color_t::blue;
+    std::size_t meetings = 0;
+    std::size_t reported = 0;
+};
+
+template <typename Backend> void run(bench::state_t &state) {
+    const std::size_t creatures = 10;
+    Backend backend(state.workers);
+    auto &mall = make_coordinator<mall_t>(backend, state);
+    for (std::size_t i = 0; i < creatures; ++i) {
+        auto creature = backend.get(i).template create_actor<creature_t>().timeout(timeout).finish();
+        creature->mall = mall.get_address();
+        creature->color = static_cast<color_t>(i % 3);
+        mall.participants.emplace_back(creature->get_address());
+    }
+    backend.run();
+    verify(state.operations == state.iterations, "chameneos");
+}
+
+} // namespace chameneos
+
+/* fork-join */
+namespace fork_join {
+
+struct task_t {
+    std::uint64_t value;
+};
+struct result_t {
+    std::uint64_t value;
+};
+
+struct worker_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&worker_t::on_task); });
+    }
+
+    void on_task(r::message_t<task_t> &message) noexcept { send<result_t>(master, message.payload.value * 2); }
+
+    r::address_ptr_t master;
+};
+
+struct master_t : public ::coordinator_t {
+    using ::coordinator_t::coordinator_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        ::coordinator_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&master_t::on_result); });
+    }
+
+    void kick_off() noexcept override {
+        rounds_left = std::max<std::size_t>(1, state->iterations / participants.size());
+        fork();
+    }
+
+    void fork() noexcept {
+        --rounds_left;
+        pending = participants.size();
+        for (std::size_t i = 0; i < participants.size(); ++i) {
+            send<task_t>(participants[i], i);
+        }
+    }
+
+    void on_result(r::message_t<result_t> &message) noexcept {
+        sum += message.payload.value;
+        ++tasks;
+        if (--pending == 0) {
+            if (rounds_left) {
+                fork();
+            } else {
+                complete(tasks);
+            }
+        }
+    }
+
+    std::size_t rounds_left = 0;
+    std::size_t pending = 0;
+    std::size_t tasks = 0;
+    std::uint64_t sum = 0;
+};
+
+template <typename Backend> void run(bench::state_t &state) {
+    const std::size_t workers = 64;
+    Backend backend(state.workers);
+    auto &master = make_coordinator<master_t>(backend, state);
+    for (std::size_t i = 0; i < workers; ++i) {
+        auto worker = backend.get(i).template create_actor<worker_t>().timeout(timeout).finish();
+        worker->master = master.get_address();
+        master.participants.emplace_back(worker->get_address());
+    }
+    backend.run();
+    auto rounds = std::max<std::size_t>(1, state.iterations / workers);
+    verify(state.operations == rounds * workers, "fork-join");
+    verify(master.sum == rounds * workers * (workers - 1), "fork-join sum");
+}
+
+} // namespace fork_join
+
+/* mailbox */
+namespace mailbox {
+
+struct go_t {
+    std::size_t count;
+};
+struct item_t {};
+
+struct sender_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&sender_t::on_go); });
+    }
+
+    void on_go(r::message_t<go_t> &message) noexcept {
+        for (std::size_t i = 0; i < message.payload.count; ++i) {
+            send<item_t>(receiver);
+        }
+    }
+
+    r::address_ptr_t receiver;
+};
+
+struct receiver_t : public ::coordinator_t {
+    using ::coordinator_t::coordinator_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        ::coordinator_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&receiver_t::on_item); });
+    }
+
+    void kick_off() noexcept override {
+        per_sender = std::max<std::size_t>(1, state->iterations / participants.size());
+        for (auto &addr : participants) {
+            send<go_t>(addr, per_sender);
+        }
+    }
+
+    void on_item(r::message_t<item_t> &) noexcept {
+        if (++received == per_sender * participants.size()) {
+            complete(received);
+        }
+    }
+
+    std::size_t per_sender = 0;
+    std::size_t received = 0;
+};
+
+template <typename Backend> void run(bench::state_t &state) {
+    const std::size_t senders = 16;
+    Backend backend(state.workers);
+    auto &receiver = make_coordinator<receiver_t>(backend, state);
+    for (std::size_t i = 0; i < senders; ++i) {
+        auto sender = backend.get(i + 1).template create_actor<sender_t>().timeout(timeout).finish();
+        sender->receiver = receiver.get_address();
+        receiver.participants.emplace_back(sender->get_address());
+    }
+    backend.run();
+    verify(state.operations == std::max<std::size_t>(1, state.iterations / senders) * senders, "mailbox");
+}
+
+} // namespace mailbox
+
+template <typename Backend> void add(bench::benchmarks_t &benchmarks, const std::string &backend) {
+    benchmarks.push_back({"ring/" + backend, 1000000, ring::run<Backend>});
+    benchmarks.push_back({"skynet/" + backend, 10000, skynet::run<Backend>});
+    benchmarks.push_back({"chameneos/" + backend, 200000, chameneos::run<Backend>});
+    benchmarks.push_back({"fork-join/" + backend, 1000000, fork_join::run<Backend>});
+    benchmarks.push_back({"mailbox/" + backend, 1000000, mailbox::run<Backend>});
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    bench::benchmarks_t benchmarks;
+#ifdef ROTOR_BENCH_THREAD
+    add<thread_backend_t>(benchmarks, "thread");
+#endif
+#ifdef ROTOR_BENCH_ASIO
+    add<asio_backend_t>(benchmarks, "asio");
+#endif
+#ifdef ROTOR_BENCH_EV
+    add<ev_backend_t>(benchmarks, "ev");
+#endif
+    return bench::run("macrobench", benchmarks, argc, argv);
+}
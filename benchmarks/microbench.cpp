@@ -0,0 +1,496 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+/*
+ * Core microbenchmarks suite: local send/dispatch, pub/sub fan-out,
+ * request/response round trip, timers, actors spawn/shutdown, subscriptions
+ * churn (all on loopless supervisor, i.e. pure rotor overhead), cross-thread
+ * ping-pong on each of the built backends and, if `rotor` is built with tracing,
+ * the tracer overhead. The results are written as JSON, see `microbench.h` for
+ * the options.
+ */
+
+#include "rotor.hpp"
+#include "loopless_supervisor.h"
+#include "microbench.h"
+#include <filesystem>
+#include <limits>
+#include <thread>
+
+#ifdef ROTOR_BENCH_THREAD
+#include "rotor/thread.hpp"
+#endif
+#ifdef ROTOR_BENCH_ASIO
+#include "rotor/asio.hpp"
+#endif
+#ifdef ROTOR_BENCH_EV
+#include "rotor/ev.hpp"
+#endif
+
+namespace r = rotor;
+
+namespace {
+
+struct ping_t {};
+struct pong_t {};
+
+namespace payload {
+struct pong_t {};
+struct ping_t {
+    using response_t = pong_t;
+};
+} // namespace payload
+
+namespace message {
+using ping_t = r::request_traits_t<payload::ping_t>::request::message_t;
+using pong_t = r::request_traits_t<payload::ping_t>::response::message_t;
+} // namespace message
+
+auto timeout = r::pt::minutes{1}; /* does not matter for loopless supervisor */
+
+using supervisor_ptr_t = r::intrusive_ptr_t<loopless_supervisor_t>;
+
+supervisor_ptr_t make_supervisor(r::system_context_t &ctx) {
+    auto sup = ctx.create_supervisor<loopless_supervisor_t>().timeout(timeout).finish();
+    sup->do_process();
+    return sup;
+}
+
+void finish(supervisor_ptr_t &sup) {
+    sup->do_shutdown();
+    sup->do_process();
+    if (!sup->finished) {
+        std::cerr << "supervisor has not been shut down\n";
+        std::abort();
+    }
+}
+
+/* local send/dispatch: the actor sends the message to itself */
+struct sender_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&sender_t::on_ping); });
+    }
+
+    void on_ping(r::message_t<ping_t> &) noexcept {
+        if (++received < total) {
+            send<ping_t>(address);
+        }
+    }
+
+    std::size_t total = 0;
+    std::size_t received = 0;
+};
+
+void send_dispatch(bench::state_t &state) {
+    r::system_context_t ctx;
+    auto sup = make_supervisor(ctx);
+    auto sender = sup->create_actor<sender_t>().timeout(timeout).finish();
+    sup->do_process();
+
+    sender->total = state.iterations;
+    state.start();
+    sender->send<ping_t>(sender->get_address());
+    sup->do_process();
+    state.stop();
+    state.operations = sender->received;
+    finish(sup);
+}
+
+/* pub/sub fan-out: each published message is delivered to all subscribers */
+struct subscriber_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>(
+            [&](auto &p) { p.subscribe_actor(&subscriber_t::on_ping, topic); });
+    }
+
+    void on_ping(r::message_t<ping_t> &) noexcept { ++received; }
+
+    r::address_ptr_t topic;
+    std::size_t received = 0;
+};
+
+void fan_out(bench::state_t &state, std::size_t subscribers) {
+    r::system_context_t ctx;
+    auto sup = make_supervisor(ctx);
+    auto topic = sup->create_address();
+    std::vector<r::intrusive_ptr_t<subscriber_t>> actors;
+    for (std::size_t i = 0; i < subscribers; ++i) {
+        auto actor = sup->create_actor<subscriber_t>().timeout(timeout).finish();
+        actor->topic = topic;
+        actors.emplace_back(std::move(actor));
+    }
+    sup->do_process();
+
+    const std::size_t batch = 1000;
+    auto messages = std::max<std::size_t>(1, state.iterations / subscribers);
+    state.start();
+    for (std::size_t sent = 0; sent < messages;) {
+        for (std::size_t i = 0; i < batch && sent < messages; ++i, ++sent) {
+            sup->put(r::make_message<ping_t>(topic));
+        }
+        sup->do_process();
+    }
+    state.stop();
+    state.operations = 0;
+    for (auto &actor : actors) {
+        state.operations += actor->received;
+    }
+    actors.clear();
+    finish(sup);
+}
+
+/* request/response round trip (including request timer start and cancellation) */
+struct server_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&server_t::on_ping); });
+    }
+
+    void on_ping(message::ping_t &req) noexcept { reply_to(req); }
+};
+
+struct client_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&client_t::on_pong); });
+    }
+
+    void on_pong(message::pong_t &) noexcept {
+        if (++received < total) {
+            request<payload::ping_t>(server).send(timeout);
+        }
+    }
+
+    r::address_ptr_t server;
+    std::size_t total = 0;
+    std::size_t received = 0;
+};
+
+void request_response(bench::state_t &state) {
+    r::system_context_t ctx;
+    auto sup = make_supervisor(ctx);
+    auto server = sup->create_actor<server_t>().timeout(timeout).finish();
+    auto client = sup->create_actor<client_t>().timeout(timeout).finish();
+    sup->do_process();
+
+    client->server = server->get_address();
+    client->total = state.iterations;
+    state.start();
+    client->request<payload::ping_t>(client->server).send(timeout);
+    sup->do_process();
+    state.stop();
+    state.operations = client->received;
+    finish(sup);
+}
+
+/* timer start and cancellation */
+struct timers_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void on_timer(r::request_id_t, bool cancelled) noexcept { cancellations += cancelled ? 1 : 0; }
+
+    void run(std::size_t count) noexcept {
+        for (std::size_t i = 0; i < count; ++i) {
+            auto timer_id = start_timer(timeout, *this, &timers_t::on_timer);
+            cancel_timer(timer_id);
+        }
+    }
+
+    std::size_t cancellations = 0;
+};
+
+void timer_start_cancel(bench::state_t &state) {
+    r::system_context_t ctx;
+    auto sup = make_supervisor(ctx);
+    auto actor = sup->create_actor<timers_t>().timeout(timeout).finish();
+    sup->do_process();
+
+    state.start();
+    actor->run(state.iterations);
+    state.stop();
+    state.operations = actor->cancellations;
+    finish(sup);
+}
+
+/* actor spawn, start and shutdown */
+struct child_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+};
+
+void spawn_shutdown(bench::state_t &state) {
+    r::system_context_t ctx;
+    auto sup = make_supervisor(ctx);
+    const std::size_t batch = 1000;
+    std::vector<r::actor_ptr_t> actors;
+    actors.reserve(batch);
+    for (std::size_t done = 0; done < state.iterations;) {
+        state.start();
+        for (std::size_t i = 0; i < batch && done < state.iterations; ++i, ++done) {
+            actors.emplace_back(sup->create_actor<child_t>().timeout(timeout).finish());
+        }
+        sup->do_process();
+        for (auto &actor : actors) {
+            actor->do_shutdown();
+        }
+        sup->do_process();
+        state.stop();
+        actors.clear();
+    }
+    finish(sup);
+}
+
+/* subscription and unsubscription of a handler (including confirmations) */
+struct churner_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void on_ping(r::message_t<ping_t> &) noexcept {}
+
+    void run(loopless_supervisor_t &sup, std::size_t count) noexcept {
+        for (std::size_t i = 0; i < count; ++i) {
+            auto info = subscribe(&churner_t::on_ping);
+            sup.do_process();
+            unsubscribe(info->handler);
+            sup.do_process();
+        }
+    }
+};
+
+void subscription_churn(bench::state_t &state) {
+    r::system_context_t ctx;
+    auto sup = make_supervisor(ctx);
+    auto actor = sup->create_actor<churner_t>().timeout(timeout).finish();
+    sup->do_process();
+
+    state.start();
+    actor->run(*sup, state.iterations);
+    state.stop();
+    finish(sup);
+}
+
+#ifdef ROTOR_ENABLE_TRACING
+/* tracer overhead: the sampled message records all its events (enqueue, dispatch,
+ * handler begin and end), i.e. an operation is a recorded event; the unsampled
+ * message is just counted down, i.e. an operation is a message. The recorded
+ * events are flushed (into temporary file) outside of the measured part, so none
+ * of them is dropped */
+void tracer_events(bench::state_t &state, bool sampled) {
+    namespace fs = std::filesystem;
+    using P = r::trace_point_t;
+    auto path = (fs::temp_directory_path() / "rotor-microbench-trace.json").string();
+    const std::size_t batch = 4096;
+    auto sampling = sampled ? 1 : std::numeric_limits<std::uint32_t>::max();
+    r::system_context_t ctx;
+    auto sup = make_supervisor(ctx);
+    auto message = r::make_message<ping_t>(sup->get_address());
+    auto actor = sup->get_address().get();
+    auto tracer = r::tracer_ptr_t(new r::tracer_t(path, sampling, batch * 8));
+
+    std::size_t events = 0;
+    for (std::size_t done = 0; done < state.iterations;) {
+        state.start();
+        for (std::size_t i = 0; i < batch && done < state.iterations; ++i, ++done) {
+            message->tracer = nullptr;
+            tracer->on_enqueue(*message);
+            if (message->tracer) {
+                tracer->record(P::dispatch, *message);
+                tracer->record(P::handler_begin, *message, actor);
+                tracer->record(P::handler_end, *message);
+                events += 4;
+            }
+        }
+        state.stop();
+        tracer->flush();
+    }
+    state.operations = sampled ? events : state.iterations;
+    if (tracer->get_dropped()) {
+        std::cerr << "trace events have been dropped\n";
+        std::abort();
+    }
+    message->tracer = nullptr;
+    tracer.reset();
+    finish(sup);
+    std::error_code ec;
+    fs::remove(path, ec);
+}
+
+/* the timestamp of each recorded event is taken via tracer clock; this is the lower bound
+ * of the recorded event cost on the platform */
+void tracer_clock(bench::state_t &state) {
+    using clock_t = r::tracer_t::clock_t;
+    clock_t::rep sum = 0;
+    state.start();
+    for (std::size_t i = 0; i < state.iterations; ++i) {
+        sum += clock_t::now().time_since_epoch().count();
+    }
+    state.stop();
+    if (!sum) {
+        std::abort();
+    }
+}
+#endif
+
+/* cross-thread ping-pong: the pinger and the ponger live on different threads */
+struct pinger_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&pinger_t::on_pong); });
+        plugin.with_casted<r::plugin::link_client_plugin_t>([&](auto &p) { p.link(ponger_addr, true); });
+    }
+
+    void on_start() noexcept override {
+        r::actor_base_t::on_start();
+        state->start();
+        send<ping_t>(ponger_addr);
+    }
+
+    void on_pong(r::message_t<pong_t> &) noexcept {
+        if (++state->operations < state->iterations) {
+            send<ping_t>(ponger_addr);
+        } else {
+            state->stop();
+            do_shutdown();
+        }
+    }
+
+    void shutdown_finish() noexcept override {
+        r::actor_base_t::shutdown_finish();
+        supervisor->shutdown();
+        ponger_addr->supervisor.shutdown();
+    }
+
+    bench::state_t *state = nullptr;
+    r::address_ptr_t ponger_addr;
+};
+
+struct ponger_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&ponger_t::on_ping); });
+    }
+
+    void on_ping(r::message_t<ping_t> &) noexcept { send<pong_t>(pinger_addr); }
+
+    r::address_ptr_t pinger_addr;
+};
+
+template <typename Supervisor>
+void setup_ping_pong(bench::state_t &state, Supervisor &sup1, Supervisor &sup2, const r::pt::time_duration &t) {
+    state.operations = 0;
+    auto ponger = sup2->template create_actor<ponger_t>().timeout(t).finish();
+    auto pinger = sup1->template create_actor<pinger_t>().timeout(t).finish();
+    pinger->state = &state;
+    pinger->ponger_addr = ponger->get_address();
+    ponger->pinger_addr = pinger->get_address();
+}
+
+#ifdef ROTOR_BENCH_THREAD
+void ping_pong_thread(bench::state_t &state) {
+    namespace rth = rotor::thread;
+    auto t = r::pt::seconds{10};
+    auto ctx1 = r::intrusive_ptr_t<rth::system_context_thread_t>(new rth::system_context_thread_t());
+    auto ctx2 = r::intrusive_ptr_t<rth::system_context_thread_t>(new rth::system_context_thread_t());
+    auto sup1 = ctx1->create_supervisor<rth::supervisor_thread_t>().timeout(t).finish();
+    auto sup2 = ctx2->create_supervisor<rth::supervisor_thread_t>().timeout(t).finish();
+    setup_ping_pong(state, sup1, sup2, t);
+
+    auto t1 = std::thread([&] { ctx1->run(); });
+    auto t2 = std::thread([&] { ctx2->run(); });
+    t1.join();
+    t2.join();
+}
+#endif
+
+#ifdef ROTOR_BENCH_ASIO
+void ping_pong_asio(bench::state_t &state) {
+    namespace asio = boost::asio;
+    namespace ra = rotor::asio;
+    auto t = r::pt::seconds{10};
+    asio::io_context io_ctx1;
+    asio::io_context io_ctx2;
+    auto ctx1 = ra::system_context_asio_t::ptr_t{new ra::system_context_asio_t(io_ctx1)};
+    auto ctx2 = ra::system_context_asio_t::ptr_t{new ra::system_context_asio_t(io_ctx2)};
+    auto strand1 = std::make_shared<asio::io_context::strand>(io_ctx1);
+    auto strand2 = std::make_shared<asio::io_context::strand>(io_ctx2);
+    auto sup1 =
+        ctx1->create_supervisor<ra::supervisor_asio_t>().strand(strand1).guard_context(true).timeout(t).finish();
+    auto sup2 =
+        ctx2->create_supervisor<ra::supervisor_asio_t>().strand(strand2).guard_context(true).timeout(t).finish();
+    setup_ping_pong(state, sup1, sup2, t);
+
+    sup1->start();
+    sup2->start();
+    auto t1 = std::thread([&] { io_ctx1.run(); });
+    auto t2 = std::thread([&] { io_ctx2.run(); });
+    t1.join();
+    t2.join();
+}
+#endif
+
+#ifdef ROTOR_BENCH_EV
+void ping_pong_ev(bench::state_t &state) {
+    namespace rev = rotor::ev;
+    auto t = r::pt::seconds{10};
+    auto loop1 = ev_loop_new(0);
+    auto loop2 = ev_loop_new(0);
+    auto ctx1 = rev::system_context_ptr_t{new rev::system_context_ev_t()};
+    auto ctx2 = rev::system_context_ptr_t{new rev::system_context_ev_t()};
+    auto sup1 = ctx1->create_supervisor<rev::supervisor_ev_t>().loop(loop1).loop_ownership(true).timeout(t).finish();
+    auto sup2 = ctx2->create_supervisor<rev::supervisor_ev_t>().loop(loop2).loop_ownership(true).timeout(t).finish();
+    setup_ping_pong(state, sup1, sup2, t);
+
+    sup1->start();
+    sup2->start();
+    auto t1 = std::thread([&] { ev_run(loop1); });
+    auto t2 = std::thread([&] { ev_run(loop2); });
+    t1.join();
+    t2.join();
+}
+#endif
+
+} // namespace
+
+int main(int argc, char **argv) {
+    using namespace std::placeholders;
+    bench::benchmarks_t benchmarks{
+        {"send-dispatch/local", 5000000, send_dispatch},
+        {"fan-out/1", 2000000, std::bind(fan_out, _1, 1)},
+        {"fan-out/10", 5000000, std::bind(fan_out, _1, 10)},
+        {"fan-out/1000", 5000000, std::bind(fan_out, _1, 1000)},
+        {"request-response/local", 1000000, request_response},
+        {"timer/start-cancel", 2000000, timer_start_cancel},
+        {"actor/spawn-shutdown", 100000, spawn_shutdown},
+        {"subscription/churn", 200000, subscription_churn},
+#ifdef ROTOR_ENABLE_TRACING
+        {"tracer/unsampled", 10000000, std::bind(tracer_events, _1, false)},
+        {"tracer/sampled", 100000, std::bind(tracer_events, _1, true)},
+        {"tracer/clock", 10000000, tracer_clock},
+#endif
+#ifdef ROTOR_BENCH_THREAD
+        {"ping-pong/thread", 100000, ping_pong_thread},
+#endif
+#ifdef ROTOR_BENCH_ASIO
+        {"ping-pong/asio", 100000, ping_pong_asio},
+#endif
+#ifdef ROTOR_BENCH_EV
+        {"ping-pong/ev", 100000, ping_pong_ev},
+#endif
+    };
+    return bench::run("microbench", benchmarks, argc, argv);
+}
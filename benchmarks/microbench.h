@@ -0,0 +1,212 @@
+#pragma once
+
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef ROTOR_BENCH_ALLOCATIONS
+#include "allocations.h"
+#endif
+
+/* minimal benchmarks harness: each benchmark performs the requested amount
+ * of operations, measuring only the relevant part via `start()`/`stop()`;
+ * the results are reported as JSON, so they can be diffed across commits */
+namespace bench {
+
+using steady_t = std::chrono::steady_clock;
+
+struct state_t {
+    /* the amount of operations to perform */
+    std::size_t iterations;
+
+    /* the amount of actually performed operations (if it differs) */
+    std::size_t operations = 0;
+
+    /* the amount of worker threads (for multi-threaded benchmarks) */
+    std::size_t workers = 2;
+
+    steady_t::duration elapsed{};
+    steady_t::time_point started{};
+
+#ifdef ROTOR_BENCH_ALLOCATIONS
+    /* heap allocations of the benchmark thread between `start()` and `stop()` */
+    rotor::test::allocations_t allocations{};
+    rotor::test::allocations_t allocations_started{};
+
+    inline void start() noexcept {
+        allocations_started = rotor::test::allocations_t::current();
+        started = steady_t::now();
+    }
+    inline void stop() noexcept {
+        elapsed += steady_t::now() - started;
+        auto diff = rotor::test::allocations_t::current() - allocations_started;
+        allocations.allocations += diff.allocations;
+        allocations.bytes += diff.bytes;
+    }
+#else
+    inline void start() noexcept { started = steady_t::now(); }
+    inline void stop() noexcept { elapsed += steady_t::now() - started; }
+#endif
+};
+
+struct benchmark_t {
+    std::string name;
+    std::size_t iterations;
+    std::function<void(state_t &)> fn;
+};
+
+using benchmarks_t = std::vector<benchmark_t>;
+
+struct result_t {
+    std::string name;
+    std::size_t operations;
+    std::vector<double> ns_per_op;
+    double allocs_per_op = -1;
+    double bytes_per_op = -1;
+};
+
+inline std::string escape(const std::string &value) {
+    std::string r;
+    for (auto c : value) {
+        if (c == '"' || c == '\\') {
+            r.push_back('\\');
+        }
+        r.push_back(c);
+    }
+    return r;
+}
+
+inline void write_json(std::ostream &out, const char *suite, const std::vector<result_t> &results, std::size_t repeat,
+                       std::size_t workers) {
+#ifdef NDEBUG
+    const char *build_type = "release";
+#else
+    const char *build_type = "debug";
+#endif
+    out << "{\n  \"suite\": \"rotor-" << suite << "\",\n  \"build_type\": \"" << build_type << "\",\n"
+        << "  \"repeat\": " << repeat << ",\n  \"workers\": " << workers << ",\n  \"benchmarks\": [";
+    bool first = true;
+    for (auto &r : results) {
+        auto sorted = r.ns_per_op;
+        std::sort(sorted.begin(), sorted.end());
+        auto median = sorted[sorted.size() / 2];
+        out << (first ? "\n" : ",\n") << std::fixed << std::setprecision(3) << "    {\"name\": \"" << escape(r.name)
+            << "\", \"operations\": " << r.operations << ", \"ns_per_op_min\": " << sorted.front()
+            << ", \"ns_per_op_median\": " << median << ", \"ns_per_op_max\": " << sorted.back()
+            << ", \"ops_per_sec\": " << std::setprecision(1) << (median > 0 ? 1e9 / median : 0.0);
+        if (r.allocs_per_op >= 0) {
+            out << std::setprecision(3) << ", \"allocs_per_op\": " << r.allocs_per_op
+                << ", \"bytes_per_op\": " << std::setprecision(1) << r.bytes_per_op;
+        }
+        out << "}";
+        first = false;
+    }
+    out << "\n  ]\n}\n";
+}
+
+/* Options:
+ *   --filter=<substring>  run only benchmarks, which names contain the substring
+ *   --repeat=<n>          the amount of runs of each benchmark (3 by default)
+ *   --scale=<x>           iterations multiplier (1.0 by default)
+ *   --workers=<n>         worker threads for multi-threaded benchmarks (hardware concurrency, at least 2)
+ *   --output=<file>       JSON report file (stdout by default)
+ *   --list                list benchmarks names
+ *
+ * The human-readable progress is written to stderr.
+ */
+inline int run(const char *suite, const benchmarks_t &benchmarks, int argc, char **argv) {
+    std::string filter;
+    std::string output;
+    std::size_t repeat = 3;
+    double scale = 1.0;
+    std::size_t workers = std::max<std::size_t>(2, std::thread::hardware_concurrency());
+    bool list = false;
+    for (int i = 1; i < argc; ++i) {
+        auto arg = std::string(argv[i]);
+        auto value = [&](const char *prefix) -> const char * {
+            auto len = std::strlen(prefix);
+            return arg.compare(0, len, prefix) == 0 ? argv[i] + len : nullptr;
+        };
+        if (auto v = value("--filter="); v) {
+            filter = v;
+        } else if (auto v = value("--repeat="); v) {
+            repeat = std::max<std::size_t>(1, static_cast<std::size_t>(std::atoll(v)));
+        } else if (auto v = value("--scale="); v) {
+            scale = std::atof(v);
+        } else if (auto v = value("--workers="); v) {
+            workers = std::max<std::size_t>(1, static_cast<std::size_t>(std::atoll(v)));
+        } else if (auto v = value("--output="); v) {
+            output = v;
+        } else if (arg == "--list") {
+            list = true;
+        } else {
+            std::cerr << "unknown option: " << arg << "\n";
+            return 1;
+        }
+    }
+
+    std::vector<result_t> results;
+    for (auto &b : benchmarks) {
+        if (!filter.empty() && b.name.find(filter) == std::string::npos) {
+            continue;
+        }
+        if (list) {
+            std::cout << b.name << "\n";
+            continue;
+        }
+        auto iterations = std::max<std::size_t>(1, static_cast<std::size_t>(b.iterations * scale));
+        result_t result{b.name, iterations, {}};
+        for (std::size_t i = 0; i < repeat; ++i) {
+            state_t state{iterations};
+            state.workers = workers;
+            b.fn(state);
+            auto operations = state.operations ? state.operations : state.iterations;
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(state.elapsed).count();
+            result.operations = operations;
+            result.ns_per_op.push_back(static_cast<double>(ns) / static_cast<double>(operations));
+#ifdef ROTOR_BENCH_ALLOCATIONS
+            result.allocs_per_op = static_cast<double>(state.allocations.allocations) / operations;
+            result.bytes_per_op = static_cast<double>(state.allocations.bytes) / operations;
+#endif
+        }
+        auto best = *std::min_element(result.ns_per_op.begin(), result.ns_per_op.end());
+        std::cerr << std::left << std::setw(36) << b.name << std::right << std::setw(12) << result.operations
+                  << " ops, " << std::fixed << std::setprecision(1) << std::setw(10) << best << " ns/op";
+        if (result.allocs_per_op >= 0) {
+            std::cerr << ", " << std::setprecision(2) << std::setw(8) << result.allocs_per_op << " allocs/op";
+        }
+        std::cerr << "\n";
+        results.emplace_back(std::move(result));
+    }
+    if (list) {
+        return 0;
+    }
+
+    if (output.empty()) {
+        write_json(std::cout, suite, results, repeat, workers);
+    } else {
+        std::ofstream out(output);
+        write_json(out, suite, results, repeat, workers);
+        if (!out) {
+            std::cerr << "cannot write " << output << "\n";
+            return 1;
+        }
+    }
+    return 0;
+}
+
+} // namespace bench
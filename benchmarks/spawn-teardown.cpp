@@ -0,0 +1,70 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+/*
+ * Spawns the specified amount of child actors (100k by default) on a single
+ * supervisor, waits until all of them are started, and then shuts down
+ * everything. Spawn and teardown rates are reported separately.
+ *
+ * If the second argument is "batch", then actors are spawned at once
+ * via `spawn_n`, otherwise one by one via `create_actor`.
+ */
+
+#include "rotor.hpp"
+#include "loopless_supervisor.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+namespace r = rotor;
+
+struct child_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+};
+
+using steady_t = std::chrono::steady_clock;
+
+static void report(const char *phase, std::size_t count, steady_t::duration duration) {
+    std::chrono::duration<double> diff = duration;
+    double rate = static_cast<double>(count) / diff.count();
+    std::cout << phase << " " << count << " actors in " << std::fixed << std::setprecision(3) << diff.count()
+              << "s, rate = " << std::setprecision(1) << rate << " actors/s\n";
+}
+
+int main(int argc, char **argv) {
+    std::size_t count = 100000;
+    if (argc > 1) {
+        count = static_cast<std::size_t>(std::atoll(argv[1]));
+    }
+    bool batch = argc > 2 && std::strcmp(argv[2], "batch") == 0;
+
+    r::system_context_t ctx{};
+    auto timeout = r::pt::minutes{1}; /* does not matter */
+    auto sup = ctx.create_supervisor<loopless_supervisor_t>().timeout(timeout).finish();
+    sup->do_process();
+
+    auto start = steady_t::now();
+    if (batch) {
+        sup->spawn_n<child_t>(count, [&](auto builder) { return std::move(builder).timeout(timeout).finish(); });
+    } else {
+        for (std::size_t i = 0; i < count; ++i) {
+            sup->create_actor<child_t>().timeout(timeout).finish();
+        }
+    }
+    sup->do_process();
+    auto spawned = steady_t::now();
+
+    sup->do_shutdown();
+    sup->do_process();
+    auto finished = steady_t::now();
+
+    report("spawn", count, spawned - start);
+    report("teardown", count, finished - spawned);
+
+    return sup->finished ? 0 : 1;
+}
@@ -99,15 +99,23 @@ int main(int argc, char **argv) {
     asio::io_context io_context{1};
     try {
         std::uint32_t count = 10000;
+        bool single_threaded = false;
         if (argc > 1) {
             boost::conversion::try_lexical_convert(argv[1], count);
         }
+        if (argc > 2) {
+            // the io_context is run by a single thread, so the strand can be bypassed
+            boost::conversion::try_lexical_convert(argv[2], single_threaded);
+        }
 
         auto system_context = ra::system_context_asio_t::ptr_t{new ra::system_context_asio_t(io_context)};
         auto strand = std::make_shared<asio::io_context::strand>(io_context);
         auto timeout = boost::posix_time::milliseconds{10};
-        auto supervisor =
-            system_context->create_supervisor<ra::supervisor_asio_t>().strand(strand).timeout(timeout).finish();
+        auto supervisor = system_context->create_supervisor<ra::supervisor_asio_t>()
+                              .strand(strand)
+                              .single_threaded(single_threaded)
+                              .timeout(timeout)
+                              .finish();
 
         auto pinger = supervisor->create_actor<pinger_t>().timeout(timeout).finish();
         auto ponger = supervisor->create_actor<ponger_t>().timeout(timeout).finish();
@@ -0,0 +1,152 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+/*
+ * Cross-thread ping-pong: pinger and ponger live on different ev loops,
+ * each one is run by its own thread, i.e. all messages go via supervisors
+ * inbound queues. The second (optional) argument is the number of pings
+ * in flight, which lets measure throughput of batched inbound delivery.
+ */
+
+#include <rotor/ev.hpp>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
+struct ping_t {};
+struct pong_t {};
+
+struct pinger_t : public rotor::actor_base_t {
+    using timepoint_t = std::chrono::time_point<std::chrono::high_resolution_clock>;
+
+    using rotor::actor_base_t::actor_base_t;
+
+    void set_pings(std::size_t pings, std::size_t window_) {
+        pings_left = pings_count = pings;
+        window = window_;
+    }
+
+    void set_ponger_addr(const rotor::address_ptr_t &addr) { ponger_addr = addr; }
+
+    void configure(rotor::plugin::plugin_base_t &plugin) noexcept override {
+        rotor::actor_base_t::configure(plugin);
+        plugin.with_casted<rotor::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&pinger_t::on_pong); });
+        // make sure ponger is ready to receive pings
+        plugin.with_casted<rotor::plugin::link_client_plugin_t>([&](auto &p) { p.link(ponger_addr, true); });
+    }
+
+    void on_start() noexcept override {
+        rotor::actor_base_t::on_start();
+        std::cout << "pings start (" << pings_left << "), in flight: " << window << "\n";
+        start = std::chrono::high_resolution_clock::now();
+        for (std::size_t i = 0; i < window && pings_left; ++i) {
+            send_ping();
+        }
+    }
+
+    void on_pong(rotor::message_t<pong_t> &) noexcept {
+        ++pongs_received;
+        if (pings_left) {
+            send_ping();
+        } else if (pongs_received == pings_count) {
+            using namespace std::chrono;
+            auto end = high_resolution_clock::now();
+            std::chrono::duration<double> diff = end - start;
+            double freq = ((double)pings_count) / diff.count();
+            std::cout << "pings finishes in " << diff.count() << "s"
+                      << ", freq = " << std::fixed << std::setprecision(10) << freq << ", real freq = " << std::fixed
+                      << std::setprecision(10) << freq * 2 << "\n";
+            do_shutdown();
+        }
+    }
+
+    // we need of this to let somebody shutdown everything
+    void shutdown_finish() noexcept override {
+        rotor::actor_base_t::shutdown_finish();
+        supervisor->shutdown();
+        ponger_addr->supervisor.shutdown();
+    }
+
+  private:
+    void send_ping() {
+        send<ping_t>(ponger_addr);
+        --pings_left;
+    }
+
+    timepoint_t start;
+    rotor::address_ptr_t ponger_addr;
+    std::size_t pings_left;
+    std::size_t pings_count;
+    std::size_t pongs_received = 0;
+    std::size_t window = 1;
+};
+
+struct ponger_t : public rotor::actor_base_t {
+
+    using rotor::actor_base_t::actor_base_t;
+
+    void set_pinger_addr(const rotor::address_ptr_t &addr) { pinger_addr = addr; }
+
+    void configure(rotor::plugin::plugin_base_t &plugin) noexcept override {
+        rotor::actor_base_t::configure(plugin);
+        plugin.with_casted<rotor::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&ponger_t::on_ping); });
+    }
+
+    void on_ping(rotor::message_t<ping_t> &) noexcept { send<pong_t>(pinger_addr); }
+
+  private:
+    rotor::address_ptr_t pinger_addr;
+};
+
+int main(int argc, char **argv) {
+    try {
+        std::uint32_t count = 10000;
+        std::uint32_t window = 1;
+        if (argc > 1) {
+            count = static_cast<std::uint32_t>(std::atoi(argv[1]));
+        }
+        if (argc > 2) {
+            window = static_cast<std::uint32_t>(std::atoi(argv[2]));
+        }
+
+        auto *loop1 = ev_loop_new(0);
+        auto *loop2 = ev_loop_new(0);
+        auto sys_ctx1 = rotor::ev::system_context_ptr_t{new rotor::ev::system_context_ev_t()};
+        auto sys_ctx2 = rotor::ev::system_context_ptr_t{new rotor::ev::system_context_ev_t()};
+        auto timeout = boost::posix_time::milliseconds{100};
+        auto sup1 = sys_ctx1->create_supervisor<rotor::ev::supervisor_ev_t>()
+                        .loop(loop1)
+                        .loop_ownership(true)
+                        .timeout(timeout)
+                        .finish();
+        auto sup2 = sys_ctx2->create_supervisor<rotor::ev::supervisor_ev_t>()
+                        .loop(loop2)
+                        .loop_ownership(true)
+                        .timeout(timeout)
+                        .finish();
+
+        auto pinger = sup1->create_actor<pinger_t>().timeout(timeout).finish();
+        auto ponger = sup2->create_actor<ponger_t>().timeout(timeout).finish();
+        pinger->set_ponger_addr(ponger->get_address());
+        ponger->set_pinger_addr(pinger->get_address());
+        pinger->set_pings(count, window);
+
+        sup1->start();
+        sup2->start();
+
+        auto t1 = std::thread([&] { ev_run(loop1); });
+        auto t2 = std::thread([&] { ev_run(loop2); });
+        t1.join();
+        t2.join();
+    } catch (const std::exception &ex) {
+        std::cout << "exception : " << ex.what();
+    }
+
+    std::cout << "exiting...\n";
+    return 0;
+}
@@ -8,12 +8,13 @@
 
 #include "forward.hpp"
 #include "address.hpp"
+#include "address_mapping.h"
 #include "actor_config.h"
 #include "messages.hpp"
+#include "pool.h"
 #include "state.h"
 #include "handler.h"
 #include "timer_handler.hpp"
-#include <set>
 
 namespace rotor {
 
@@ -203,11 +204,14 @@ struct actor_base_t : public arc_base_t<actor_base_t> {
     /** \brief propaagtes subscription message to corresponding actors */
     void on_subscription(message::subscription_t &message) noexcept;
 
+    /** \brief propagates subscription confirmation to the corresponding plugins */
+    void on_subscription(const subscription_point_t &point) noexcept;
+
     /** \brief propaagtes unsubscription message to corresponding actors */
     void on_unsubscription(message::unsubscription_t &message) noexcept;
 
-    /** \brief propaagtes external unsubscription message to corresponding actors */
-    void on_unsubscription_external(message::unsubscription_external_t &message) noexcept;
+    /** \brief propagates unsubscription (from internal or external address) to the corresponding plugins */
+    void on_unsubscription(const subscription_point_t &point, bool external) noexcept;
 
     /** \brief creates new unique address for an actor (via address_maker plugin) */
     address_ptr_t create_address() noexcept;
@@ -359,26 +363,60 @@ struct actor_base_t : public arc_base_t<actor_base_t> {
     /** \brief non-owning pointer to resources plugin */
     plugin::resources_plugin_t *resources = nullptr;
 
+    /** \brief non-owning pointer to metrics plugin (if the actor is observed) */
+    plugin::metrics_plugin_t *metrics = nullptr;
+
     /** \brief finds plugin by plugin class identity
      *
      * `nullptr` is returned when plugin cannot be found
      */
     plugin::plugin_base_t *get_plugin(const void *identity) const noexcept;
 
-    /** \brief set of activating plugin identities */
-    std::set<const void *> activating_plugins;
+    /** \brief returns position of the plugin in the plugins list */
+    std::size_t get_plugin_index(const plugin::plugin_base_t &plugin) const noexcept;
+
+    /** \brief set of activating plugins */
+    plugins_mask_t activating_plugins;
 
-    /** \brief set of deactivating plugin identities */
-    std::set<const void *> deactivating_plugins;
+    /** \brief set of deactivating plugins */
+    plugins_mask_t deactivating_plugins;
 
     /** \brief timer-id to timer-handler map */
     timers_map_t timers_map;
 
+    /** \brief per-message request tracking support, maintained by the supervisor */
+    address_mapping_t address_mapping;
+
     friend struct plugin::plugin_base_t;
+    friend struct plugin::delivery_plugin_base_t;
     friend struct plugin::lifetime_plugin_t;
+    friend struct plugin::metrics_plugin_t;
     friend struct supervisor_t;
     template <typename T> friend struct request_builder_t;
     template <typename T, typename M> friend struct accessor_t;
 };
 
+/** \struct minimal_actor_t
+ *  \brief low-footprint actor with the trimmed plugins list
+ *
+ * The actor can be initialized, started and shut down by its supervisor,
+ * and it can subscribe and send messages, but it has no linking, registry and
+ * resources capabilities, i.e. it cannot be linked by other actors, cannot
+ * register itself (or discover other actors) in the registry and cannot
+ * suspend its init/shutdown. It fits for massive amounts of trivial workers.
+ *
+ */
+struct minimal_actor_t : public actor_base_t {
+    // clang-format off
+    /** \brief the minimal list of plugins for an actor */
+    using plugins_list_t = std::tuple<
+        plugin::address_maker_plugin_t,
+        plugin::lifetime_plugin_t,
+        plugin::init_shutdown_plugin_t,
+        plugin::starter_plugin_t>;
+    // clang-format on
+
+    using actor_base_t::actor_base_t;
+};
+
 } // namespace rotor
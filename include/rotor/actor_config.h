@@ -6,10 +6,11 @@
 // Distributed under the MIT Software License
 //
 
-#include <deque>
+#include <cstdint>
 #include <tuple>
 #include <functional>
 #include <memory>
+#include <vector>
 #include "arc.hpp"
 #include "plugins.h"
 #include "policy.h"
@@ -18,7 +19,42 @@
 namespace rotor {
 
 /** \brief list of raw plugin pointers*/
-using plugins_t = std::deque<plugin::plugin_base_t *>;
+using plugins_t = std::vector<plugin::plugin_base_t *>;
+
+/** \struct plugins_mask_t
+ * \brief compact set of actor plugins
+ *
+ * A plugin is identified by its position in the actor plugins list, which
+ * is known at compile time, so the set is just a bitmask.
+ */
+struct plugins_mask_t {
+    /** \brief max amount of plugins per actor */
+    static constexpr std::size_t capacity = 32;
+
+    /** \brief adds plugin (identified by its index) to the set */
+    inline void insert(std::size_t index) noexcept { bits |= (std::uint32_t{1} << index); }
+
+    /** \brief removes plugin (identified by its index) from the set */
+    inline void erase(std::size_t index) noexcept { bits &= ~(std::uint32_t{1} << index); }
+
+    /** \brief returns true if the plugin (identified by its index) is in the set */
+    inline bool contains(std::size_t index) const noexcept { return bits & (std::uint32_t{1} << index); }
+
+    /** \brief returns true if there are no plugins in the set */
+    inline bool empty() const noexcept { return bits == 0; }
+
+    /** \brief returns amount of plugins in the set */
+    inline std::size_t size() const noexcept {
+        std::size_t count = 0;
+        for (auto value = bits; value; value &= value - 1) {
+            ++count;
+        }
+        return count;
+    }
+
+    /** \brief the bitmask itself */
+    std::uint32_t bits = 0;
+};
 
 /** \struct  plugin_storage_base_t
  * \brief abstract item to store plugins inside actor */
@@ -34,8 +70,11 @@ using plugin_storage_ptr_t = std::unique_ptr<plugin_storage_base_t>;
 
 /** \brief templated plugin storage implementation */
 template <typename PluginList> struct plugin_storage_t : plugin_storage_base_t {
+    static_assert(std::tuple_size_v<PluginList> <= plugins_mask_t::capacity, "too many plugins");
+
     plugins_t get_plugins() noexcept override {
         plugins_t plugins;
+        plugins.reserve(std::tuple_size_v<PluginList>);
         add_plugin(plugins);
         return plugins;
     }
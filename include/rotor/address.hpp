@@ -7,6 +7,7 @@
 //
 
 #include "arc.hpp"
+#include "pool.h"
 
 namespace rotor {
 
@@ -32,7 +33,7 @@ struct supervisor_t;
  *
  */
 
-struct address_t : public arc_base_t<address_t> {
+struct address_t : public arc_base_t<address_t>, pool_allocated_t {
     /// reference to {@link supervisor_t}, which generated the address
     supervisor_t &supervisor;
 
@@ -7,8 +7,7 @@
 //
 
 #include "arc.hpp"
-#include "subscription.h"
-#include <unordered_map>
+#include "subscription_point.h"
 #include <vector>
 
 namespace rotor {
@@ -24,6 +23,9 @@ namespace rotor {
  * mapping is done on `per-request` basis. The `address_mapping_t` performs only
  * `per-message-type` mapping.
  *
+ * The mapping is stored on the actor; as an actor usually does requests of a
+ * few types only, it is flat array of the points, which is scanned by message type.
+ *
  */
 struct address_mapping_t {
     /** \brief associates temporal destination point with actor's message type
@@ -35,33 +37,45 @@ struct address_mapping_t {
      * In the routing the temporal destination address is usually some
      * supervisor's address.
      *
+     * Returns true, if it is the first subscription in the mapping.
+     *
      */
-    void set(actor_base_t &actor, const subscription_info_ptr_t &info) noexcept;
+    bool set(const subscription_info_ptr_t &info) noexcept;
 
-    /** \brief returns temporal destination address for the actor/message type */
-    address_ptr_t get_mapped_address(actor_base_t &actor, const void *message) noexcept;
-
-    /** \brief iterates on all subscriptions for an actor */
-    template <typename Fn> void each_subscription(const actor_base_t &actor, Fn &&fn) const noexcept {
-        auto it_mappings = actor_map.find(static_cast<const void *>(&actor));
-        for (auto it : it_mappings->second) {
-            fn(it.second);
+    /** \brief returns temporal destination address for the message type */
+    inline const address_ptr_t *get_mapped_address(const void *message) const noexcept {
+        for (auto &point : points) {
+            if (point.message_type == message) {
+                return &point.info->address;
+            }
         }
+        return nullptr;
     }
 
-    /** \brief checks whether an actor has any subscriptions */
-    bool has_subscriptions(const actor_base_t &actor) const noexcept;
+    /** \brief iterates on all subscriptions */
+    template <typename Fn> void each_subscription(Fn &&fn) const noexcept {
+        for (auto &point : points) {
+            fn(point.info);
+        }
+    }
 
-    /** \brief returns true if there is no any subscription for any actor */
-    bool empty() const noexcept { return actor_map.empty(); }
+    /** \brief returns true if there is no any subscription */
+    bool empty() const noexcept { return points.empty(); }
 
-    /** \brief forgets subscription point */
-    void remove(const subscription_point_t &point) noexcept;
+    /** \brief forgets subscription point
+     *
+     * Returns true, if it was the last subscription in the mapping.
+     *
+     */
+    bool remove(const subscription_point_t &point) noexcept;
 
   private:
-    using point_map_t = std::unordered_map<const void *, subscription_info_ptr_t>;
-    using actor_map_t = std::unordered_map<const void *, point_map_t>;
-    actor_map_t actor_map;
+    struct point_t {
+        const void *message_type;
+        subscription_info_ptr_t info;
+    };
+    using points_t = std::vector<point_t>;
+    points_t points;
 };
 
 } // namespace rotor
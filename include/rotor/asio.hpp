@@ -11,6 +11,7 @@
  */
 
 #include "rotor/asio/forwarder.hpp"
+#include "rotor/asio/handler_allocator.hpp"
 #include "rotor/asio/supervisor_asio.h"
 #include "rotor/asio/supervisor_config_asio.h"
 #include "rotor/asio/system_context_asio.h"
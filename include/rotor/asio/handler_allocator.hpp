@@ -0,0 +1,77 @@
+#pragma once
+
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "rotor/pool.h"
+#include <boost/asio/associated_allocator.hpp>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace rotor {
+namespace asio {
+
+/** \struct handler_allocator_t
+ * \brief recycling allocator for boost::asio completion handlers
+ *
+ * The memory blocks are taken from and returned to the thread-local
+ * free lists of `rotor` memory pool (see `details::pool_allocate`), so the
+ * steady-state deferring of handlers (i.e. messages delivery, timers triggering,
+ * forwarders invocation) does not hit the heap.
+ *
+ * The memory block might be released on the different thread than it
+ * was allocated, then it is cached on the releasing thread.
+ */
+template <typename T> struct handler_allocator_t {
+    /** \brief allocated type */
+    using value_type = T;
+
+    handler_allocator_t() noexcept = default;
+
+    /** \brief rebinding constructor */
+    template <typename U> handler_allocator_t(const handler_allocator_t<U> &) noexcept {}
+
+    /** \brief allocates memory for `n` objects of type `T` */
+    T *allocate(std::size_t n) { return static_cast<T *>(rotor::details::pool_allocate(sizeof(T) * n)); }
+
+    /** \brief deallocates memory of `n` objects of type `T` */
+    void deallocate(T *ptr, std::size_t n) noexcept { rotor::details::pool_recycle(ptr, sizeof(T) * n); }
+
+    /** \brief all allocators are interchangeable */
+    template <typename U> bool operator==(const handler_allocator_t<U> &) const noexcept { return true; }
+
+    /** \brief all allocators are interchangeable */
+    template <typename U> bool operator!=(const handler_allocator_t<U> &) const noexcept { return false; }
+};
+
+/** \struct allocated_handler_t
+ * \brief boost::asio completion handler wrapper with associated recycling allocator
+ */
+template <typename Handler> struct allocated_handler_t {
+    /** \brief associated allocator type, which is picked up by boost::asio */
+    using allocator_type = handler_allocator_t<char>;
+
+    /** \brief wraps the handler */
+    template <typename H> explicit allocated_handler_t(H &&handler_) : handler{std::forward<H>(handler_)} {}
+
+    /** \brief returns associated allocator */
+    allocator_type get_allocator() const noexcept { return allocator_type{}; }
+
+    /** \brief invokes the wrapped handler */
+    template <typename... Args> inline void operator()(Args &&...args) { handler(std::forward<Args>(args)...); }
+
+    /** \brief the wrapped handler */
+    Handler handler;
+};
+
+/** \brief wraps boost::asio completion handler to use recycling allocator */
+template <typename Handler> inline auto make_allocated_handler(Handler &&handler) {
+    return allocated_handler_t<std::decay_t<Handler>>(std::forward<Handler>(handler));
+}
+
+} // namespace asio
+} // namespace rotor
@@ -10,6 +10,7 @@
 #include "supervisor_config_asio.h"
 #include "system_context_asio.h"
 #include "forwarder.hpp"
+#include "handler_allocator.hpp"
 #include <boost/asio.hpp>
 #include <unordered_map>
 #include <memory>
@@ -46,6 +47,11 @@ template <typename Actor, typename Handler, typename ArgsCount, typename ErrHand
  * handler, the change should be performed in synchronized way, i.e.
  * via `strand`.
  *
+ * If the io_context is run by exactly one thread, the supervisor can be
+ * configured as `single_threaded`; then the strand locking is avoided and
+ * the plain io_context executor is used for deferring. The strand
+ * remains the locality (identity) of the supervisor.
+ *
  */
 struct supervisor_asio_t : public supervisor_t {
 
@@ -79,6 +85,22 @@ struct supervisor_asio_t : public supervisor_t {
     /** \brief returns exeuction strand */
     inline asio::io_context::strand &get_strand() noexcept { return *strand; }
 
+    /** \brief defers function invocation in the supervisor execution context
+     *
+     * The function is executed via strand, or directly via io_context
+     * executor for single-threaded supervisor.
+     *
+     * The function closure is allocated via recycling {@link handler_allocator_t}.
+     *
+     */
+    template <typename Fn> inline void defer(Fn &&fn) noexcept {
+        if (single_threaded) {
+            asio::defer(strand->context(), make_allocated_handler(std::forward<Fn>(fn)));
+        } else {
+            asio::defer(*strand, make_allocated_handler(std::forward<Fn>(fn)));
+        }
+    }
+
   protected:
     /** \struct timer_t
      * \brief boos::asio::deadline_timer with embedded timer handler */
@@ -115,6 +137,9 @@ struct supervisor_asio_t : public supervisor_t {
 
     /** \brief guard to control ownership of the io-context */
     guard_ptr_t guard;
+
+    /** \brief whether the io_context is run by the single thread */
+    bool single_threaded;
 };
 
 template <typename Actor> inline boost::asio::io_context::strand &get_strand(Actor &actor) {
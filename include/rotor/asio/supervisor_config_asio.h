@@ -28,6 +28,14 @@ struct supervisor_config_asio_t : public supervisor_config_t {
     /** \brief should supervisor take ownership on the io_context */
     bool guard_context = false;
 
+    /** \brief whether the io_context is run by the single thread only
+     *
+     * In that case the strand is not used for serialization, and
+     * the plain io_context executor is used instead.
+     *
+     */
+    bool single_threaded = false;
+
     using supervisor_config_t::supervisor_config_t;
 };
 
@@ -61,6 +69,16 @@ template <typename Supervisor> struct supervisor_config_asio_builder_t : supervi
         parent_t::config.guard_context = value;
         return std::move(*static_cast<builder_t *>(this));
     }
+
+    /** \brief declares that the io_context is run by the single thread only
+     *
+     * The strand is still required, as it defines the supervisor locality.
+     *
+     */
+    builder_t &&single_threaded(bool value) && {
+        parent_t::config.single_threaded = value;
+        return std::move(*static_cast<builder_t *>(this));
+    }
 };
 
 } // namespace asio
@@ -0,0 +1,199 @@
+#pragma once
+
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+/** \file coroutine.hpp
+ * C++20 coroutines support for requests, i.e.
+ *
+ * \code
+ * auto res = co_await request<payload_t>(addr, args...).co_send(timeout);
+ * \endcode
+ *
+ * The actor should have {@link plugin::coroutine_plugin_t} in its plugins list.
+ */
+
+#include "supervisor.h"
+#include "plugin/coroutine.h"
+
+#if !defined(__cpp_impl_coroutine)
+#error "rotor/coroutine.hpp requires C++20 coroutines support"
+#endif
+
+#include <coroutine>
+#include <exception>
+#include <new>
+
+namespace rotor {
+
+namespace details {
+
+/** \struct coroutine_arg_t
+ * \brief placeholder for any coroutine parameter, which follows the actor
+ *
+ * It keeps the coroutine frame allocation function non-template, so it
+ * properly pairs with the frame deallocation function.
+ */
+struct coroutine_arg_t {
+    /** \brief accepts (and ignores) any coroutine parameter */
+    template <typename T> coroutine_arg_t(const T &) noexcept {}
+};
+
+} // namespace details
+
+/** \struct coroutine_t
+ * \brief fire-and-forget coroutine type for actors
+ *
+ * The coroutine starts eagerly and its frame is destroyed upon completion.
+ *
+ * If the first coroutine parameter is an actor (or, for member functions,
+ * the coroutine belongs to an actor), and the actor has
+ * {@link plugin::coroutine_plugin_t}, then the coroutine frame is taken
+ * from the per-actor pool. That is possible for coroutines with up to
+ * `max_args` other parameters.
+ *
+ * If the frame cannot be allocated, the coroutine is not started.
+ *
+ * The coroutine is allowed to be suspended only on rotor requests, as
+ * it is executed in the actor's context.
+ *
+ */
+struct coroutine_t {
+    /** \struct promise_type
+     * \brief coroutine promise, which does the frame allocation */
+    /** \brief the maximum amount of coroutine parameters after the actor, to have frame from the actor's pool */
+    static constexpr std::size_t max_args = 8;
+
+    struct promise_type {
+        /** \brief alias for any coroutine parameter after the actor */
+        using arg_t = details::coroutine_arg_t;
+
+        /** \brief coroutine frame allocation from the actor's pool */
+        static void *operator new(std::size_t size, actor_base_t &actor, arg_t = 0, arg_t = 0, arg_t = 0, arg_t = 0,
+                                  arg_t = 0, arg_t = 0, arg_t = 0, arg_t = 0) noexcept {
+            auto plugin = plugin::coroutine_plugin_t::get(actor);
+            if (!plugin) {
+                return allocate(size);
+            }
+            auto ptr = static_cast<char *>(plugin->allocate_frame(size + header_size));
+            if (!ptr) {
+                return nullptr;
+            }
+            *reinterpret_cast<plugin::coroutine_plugin_t **>(ptr) = plugin;
+            return ptr + header_size;
+        }
+
+        /** \brief generic coroutine frame allocation */
+        static void *operator new(std::size_t size) noexcept { return allocate(size); }
+
+        /** \brief returns coroutine frame into actor's pool (if any) */
+        static void operator delete(void *frame, std::size_t size) noexcept {
+            auto ptr = static_cast<char *>(frame) - header_size;
+            auto plugin = *reinterpret_cast<plugin::coroutine_plugin_t **>(ptr);
+            if (plugin) {
+                plugin->deallocate_frame(ptr, size + header_size);
+            } else {
+                ::operator delete(ptr);
+            }
+        }
+
+        /** \brief coroutine frame allocation failure */
+        static coroutine_t get_return_object_on_allocation_failure() noexcept { return {}; }
+
+        /** \brief returns fire-and-forget coroutine object */
+        coroutine_t get_return_object() noexcept { return {}; }
+
+        /** \brief coroutine is eager */
+        std::suspend_never initial_suspend() noexcept { return {}; }
+
+        /** \brief coroutine frame is destroyed on completion */
+        std::suspend_never final_suspend() noexcept { return {}; }
+
+        /** \brief no result is expected */
+        void return_void() noexcept {}
+
+        /** \brief exceptions are not allowed to escape actors */
+        void unhandled_exception() noexcept { std::terminate(); }
+
+      private:
+        static constexpr std::size_t header_size = alignof(std::max_align_t);
+
+        static void *allocate(std::size_t size) noexcept {
+            auto ptr = static_cast<char *>(::operator new(size + header_size, std::nothrow));
+            if (!ptr) {
+                return nullptr;
+            }
+            *reinterpret_cast<plugin::coroutine_plugin_t **>(ptr) = nullptr;
+            return ptr + header_size;
+        }
+    };
+};
+
+/** \struct request_awaiter_t
+ * \brief awaitable for request, which resumes the coroutine with the response message
+ *
+ * The response might be successful as well as error one (e.g. timeout),
+ * so `payload.ec` of the response should be checked.
+ *
+ */
+template <typename T> struct [[nodiscard]] request_awaiter_t {
+    /** \brief intrusive pointer type for response message */
+    using response_message_ptr_t = typename request_traits_t<T>::response::message_ptr_t;
+
+    /** \brief constructs awaiter from already prepared request */
+    request_awaiter_t(request_builder_t<T> &&builder_, plugin::coroutine_plugin_t &plugin_,
+                      const pt::time_duration &timeout_) noexcept
+        : builder{std::move(builder_)}, plugin{plugin_}, timeout{timeout_} {}
+
+    /** \brief the response is never ready before the request is sent */
+    bool await_ready() const noexcept { return false; }
+
+    /** \brief sends the request and suspends the coroutine until response arrival */
+    void await_suspend(std::coroutine_handle<> handle) noexcept {
+        auto request_id = builder.send(timeout);
+        plugin.suspend(request_id, handle.address(), result, &resume);
+    }
+
+    /** \brief returns the response message */
+    response_message_ptr_t await_resume() noexcept {
+        using response_message_t = typename request_traits_t<T>::response::message_t;
+        return response_message_ptr_t(static_cast<response_message_t *>(result.get()));
+    }
+
+  private:
+    static void resume(void *frame) noexcept { std::coroutine_handle<>::from_address(frame).resume(); }
+
+    request_builder_t<T> builder;
+    plugin::coroutine_plugin_t &plugin;
+    pt::time_duration timeout;
+    message_ptr_t result;
+};
+
+template <typename T> request_awaiter_t<T> request_builder_t<T>::co_send(pt::time_duration timeout) noexcept {
+    auto plugin = plugin::coroutine_plugin_t::get(actor);
+    assert(plugin && "coroutine_plugin_t is expected to be present in actor's plugins list");
+    plugin->template watch<response_message_t>();
+    req->payload.origin = plugin->get_reply_address();
+    return request_awaiter_t<T>(std::move(*this), *plugin, timeout);
+}
+
+namespace plugin {
+
+template <typename Message> void coroutine_plugin_t::watch() noexcept {
+    auto type = Message::message_type;
+    if (watched.count(type) == 0) {
+        subscribe(&coroutine_plugin_t::on_reply<Message>, reply_address);
+        watched.emplace(type);
+    }
+}
+
+template <typename Message> void coroutine_plugin_t::on_reply(Message &message) noexcept {
+    resume(message.payload.request_id(), message);
+}
+
+} // namespace plugin
+
+} // namespace rotor
@@ -11,7 +11,8 @@
 #include "rotor/ev/system_context_ev.h"
 #include "rotor/system_context.h"
 #include <ev.h>
-#include <mutex>
+#include <boost/lockfree/queue.hpp>
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 
@@ -104,23 +105,33 @@ struct supervisor_ev_t : public supervisor_t {
     /** \brief ev-loop specific thread-safe wake-up notifier for external messages delivery */
     ev_async async_watcher;
 
-    /** \brief mutex for protecting inbound queue and pending flag */
-    std::mutex inbound_mutex;
+    /** \brief lock-free MPSC queue of raw (detached) message pointers */
+    using inbound_queue_t = boost::lockfree::queue<message_base_t *>;
 
-    /** \brief whether refcounter should be decreased
+    /** \brief whether async notification is issued, but inbound queue is not drained yet
      *
      * Async events are "compressed" by EV, i.e. a few async sygnals can be
      * delivere as one. As we do inc/dec for atomic counter, this might be
      * a problem. So by the flag we are sure, that inc/dec will happen
-     * only once.
+     * only once; as the bonus `ev_async_send` is invoked only on the
+     * empty to non-empty inbound queue transition.
+     *
+     * The flag is the only state, shared with the foreign threads: when
+     * the locality leader is shut down, it is raised forever, so no more
+     * notifications are issued, and the messages enqueued after that
+     * are just released in the destructor.
      *
      */
-    bool pending;
+    std::atomic_bool pending;
 
     /** \brief inbound messages queue, i.e.the structure to hold messages
      * received from other supervisors / threads
+     *
+     * The queue is not fixed-sized, so a push fails only when a new node
+     * cannot be allocated; then the message is dropped and the failure is
+     * reported via `system_context_t::on_error`.
      */
-    messages_queue_t inbound;
+    inbound_queue_t inbound;
 
     /** \brief timer_id to timer map */
     timers_map_t timers_map;
@@ -128,7 +139,8 @@ struct supervisor_ev_t : public supervisor_t {
     friend struct supervisor_ev_shutdown_t;
 
   private:
-    bool move_inbound_queue() noexcept;
+    void notify() noexcept;
+    void move_inbound_queue() noexcept;
 };
 
 } // namespace ev
@@ -97,7 +97,7 @@ template <typename M, typename H> struct handler_traits<lambda_holder_t<M, H>> {
  *  \brief Base class for `rotor` handler, i.e concrete message type processing point
  * on concrete actor
  */
-struct handler_base_t : public arc_base_t<handler_base_t> {
+struct handler_base_t : public arc_base_t<handler_base_t>, pool_allocated_t {
     /** \brief pointer to unique message type ( `typeid(Message).name()` ) */
     const void *message_type;
 
@@ -159,6 +159,9 @@ struct continuation_t {
 
     /** \brief continue handler invocation */
     virtual void operator()() const noexcept = 0;
+
+    /** \brief returns the handler, which invocation is continued, if it is known */
+    virtual handler_base_t *get_handler() const noexcept { return nullptr; }
 };
 
 /** \struct handler_intercepted_t
@@ -0,0 +1,115 @@
+#pragma once
+
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include <array>
+#include <cstdint>
+
+namespace rotor {
+
+/** \struct histogram_t
+ *  \brief log-bucketed (HDR-style) histogram of non-negative values, e.g. durations in nanoseconds
+ *
+ * The values are grouped by power-of-two ranges, and each range is split
+ * into `sub_buckets` linear buckets, i.e. the recorded value is known with
+ * relative error no more than `1/sub_buckets` (12.5%). The values less then
+ * `sub_buckets` are recorded exactly, the values greater than `2^max_bits`
+ * are recorded into the last bucket (the exact maximum is still tracked).
+ *
+ * Recording is O(1) and it never allocates, the histogram is fixed-size.
+ *
+ */
+struct histogram_t {
+    /** \brief the amount of bits of value precision within power-of-two range */
+    static constexpr std::uint32_t sub_bits = 3;
+
+    /** \brief the amount of linear buckets within power-of-two range */
+    static constexpr std::uint32_t sub_buckets = 1u << sub_bits;
+
+    /** \brief the values above `2^max_bits` (~18 minutes in nanoseconds) are not distinguished */
+    static constexpr std::uint32_t max_bits = 40;
+
+    /** \brief total amount of buckets */
+    static constexpr std::uint32_t buckets = (max_bits - sub_bits + 1) * sub_buckets;
+
+    /** \brief records the value */
+    inline void record(std::uint64_t value) noexcept {
+        ++counts[bucket_of(value)];
+        ++total;
+        sum += value;
+        if (value < min_value) {
+            min_value = value;
+        }
+        if (value > max_value) {
+            max_value = value;
+        }
+    }
+
+    /** \brief returns the amount of recorded values */
+    inline std::uint64_t count() const noexcept { return total; }
+
+    /** \brief returns the minimum recorded value (zero, if there are no values) */
+    inline std::uint64_t min() const noexcept { return total ? min_value : 0; }
+
+    /** \brief returns the maximum recorded value */
+    inline std::uint64_t max() const noexcept { return max_value; }
+
+    /** \brief returns the mean of recorded values */
+    inline double mean() const noexcept { return total ? static_cast<double>(sum) / total : 0.0; }
+
+    /** \brief returns the value, at or below which the `percentile` (0..100) of recorded values are
+     *
+     * The value is the upper bound of the corresponding bucket, but no more than
+     * the maximum recorded value.
+     *
+     */
+    std::uint64_t percentile(double percentile) const noexcept;
+
+    /** \brief adds the recorded values of the other histogram */
+    void merge(const histogram_t &other) noexcept;
+
+    /** \brief forgets all recorded values */
+    void reset() noexcept;
+
+    /** \brief returns the bucket index for the value */
+    static inline std::uint32_t bucket_of(std::uint64_t value) noexcept {
+        if (value < sub_buckets) {
+            return static_cast<std::uint32_t>(value);
+        }
+        auto exponent = log2(value);
+        if (exponent >= max_bits) {
+            return buckets - 1;
+        }
+        auto shift = exponent - sub_bits;
+        auto sub = static_cast<std::uint32_t>(value >> shift) - sub_buckets;
+        return (shift + 1) * sub_buckets + sub;
+    }
+
+    /** \brief returns the maximum value, which is recorded into the bucket */
+    static std::uint64_t upper_bound(std::uint32_t bucket) noexcept;
+
+  private:
+    static inline std::uint32_t log2(std::uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return 63u - static_cast<std::uint32_t>(__builtin_clzll(value));
+#else
+        std::uint32_t r = 0;
+        while (value >>= 1) {
+            ++r;
+        }
+        return r;
+#endif
+    }
+
+    std::array<std::uint64_t, buckets> counts{};
+    std::uint64_t total = 0;
+    std::uint64_t sum = 0;
+    std::uint64_t min_value = ~std::uint64_t(0);
+    std::uint64_t max_value = 0;
+};
+
+} // namespace rotor
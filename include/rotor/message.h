@@ -8,11 +8,14 @@
 
 #include "arc.hpp"
 #include "address.hpp"
+#include <chrono>
 #include <typeindex>
 #include <deque>
 
 namespace rotor {
 
+struct tracer_t;
+
 /** \struct message_base_t
  *  \brief Base class for `rotor` message.
  *
@@ -37,6 +40,20 @@ struct message_base_t : public arc_base_t<message_base_t> {
     /** \brief message destination address */
     address_ptr_t address;
 
+#ifdef ROTOR_ENABLE_METRICS
+    /** \brief the time, when the message has been enqueued first, if it was needed for metrics
+     *
+     * It is set by `supervisor_t::put()` or by `supervisor_t::enqueue()`, when the destination
+     * supervisor has actors with metrics plugin or collects queueing statistics.
+     */
+    std::chrono::steady_clock::time_point enqueued_at;
+#endif
+
+#ifdef ROTOR_ENABLE_TRACING
+    /** \brief non-owning pointer to the tracer, if the message is traced */
+    tracer_t *tracer = nullptr;
+#endif
+
     /** \brief constructor which takes destination address */
     message_base_t(const void *type_index_, const address_ptr_t &addr) : type_index{type_index_}, address{addr} {}
 };
@@ -12,6 +12,7 @@
 #include "request.hpp"
 #include "subscription_point.h"
 #include "forward.hpp"
+#include <vector>
 
 namespace rotor {
 
@@ -59,6 +60,26 @@ struct create_actor_t {
     pt::time_duration timeout;
 };
 
+/** \struct create_actors_t
+ *  \brief Message with this payload is sent to supervisor when a batch of
+ * actors is created at once (see `supervisor_t::spawn_n`).
+ *
+ * All actors of the batch share the single initialization deadline.
+ *
+ */
+struct create_actors_t {
+    /** \brief the intrusive pointers to created actors */
+    std::vector<actor_ptr_t> actors;
+
+    /** \brief maximum time for initialization of all actors of the batch
+     *
+     * The actors, which are not able to confirm initialization in time, will
+     * be asked to shutdown (default behavior)
+     *
+     */
+    pt::time_duration timeout;
+};
+
 /** \struct shutdown_trigger_t
  *  \brief Message with this payload is sent to ask an actor's supervisor
  * to initate shutdown procedure.
@@ -126,22 +147,14 @@ struct external_subscription_t {
  *
  * The message is needed for internal {@link actor_base_t} housekeeping.
  *
- */
-struct subscription_confirmation_t {
-    /** \brief subscription details */
-    subscription_point_t point;
-};
-
-/** \struct external_unsubscription_t
- *  \brief Message with this payload is forwarded to the target address supervisor
- * for recording unsubscription in the external (foreign) handler.
- *
- * The message is symmetrical to the {@link external_subscription_t}.
+ * Usually it confirms a single subscription; if the batch of confirmations
+ * is open (see {@link plugin::lifetime_plugin_t::begin_subscriptions}), then
+ * it confirms all the subscriptions of the batch (in the same order).
  *
  */
-struct external_unsubscription_t {
+struct subscription_confirmation_t {
     /** \brief subscription details */
-    subscription_point_t point;
+    subscription_points_t points;
 };
 
 /** \struct commit_unsubscription_t
@@ -149,20 +162,30 @@ struct external_unsubscription_t {
  * for confirming unsubscription in the external (foreign) handler.
  *
  * The message is an actor-reply to {@link external_subscription_t} request.
+ * The batched unsubscriptions of an actor are committed with a single message
+ * per foreign supervisor.
  *
  */
 struct commit_unsubscription_t {
     /** \brief subscription details */
-    subscription_point_t point;
+    subscription_points_t points;
 };
 
 /** \struct unsubscription_confirmation_t
  *  \brief Message with this payload is sent from a supervisor to an actor with
- *  confirmation that `pooint` is no longer active (subscribed).`
+ *  confirmation that `points` are no longer active (subscribed).
+ *
+ * Usually it confirms a single unsubscription (from internal or external address);
+ * if the batch of unsubscriptions is open (see {@link plugin::lifetime_plugin_t::begin_unsubscriptions}),
+ * then it confirms all the unsubscriptions of the batch. The unsubscriptions from external
+ * addresses are symmetrical to the {@link external_subscription_t}.
  */
 struct unsubscription_confirmation_t {
-    /** \brief subscription details */
-    subscription_point_t point;
+    /** \brief details of the unsubscriptions from internal addresses */
+    subscription_points_t points;
+
+    /** \brief details of the unsubscriptions from external (foreign) addresses */
+    subscription_points_t external_points;
 };
 
 /** \struct state_response_t
@@ -305,8 +328,6 @@ namespace message {
 // subscription-related
 /** \brief unsubscription confirmation message */
 using unsubscription_t = message_t<payload::unsubscription_confirmation_t>;
-/** \brief external unsubscription message */
-using unsubscription_external_t = message_t<payload::external_unsubscription_t>;
 /** \brief subscription confirmation message */
 using subscription_t = message_t<payload::subscription_confirmation_t>;
 
@@ -341,6 +362,9 @@ using shutdown_response_t = request_traits_t<payload::shutdown_request_t>::respo
 /** \brief supervisor's message upon actor instantiation */
 using create_actor_t = message_t<payload::create_actor_t>;
 
+/** \brief supervisor's message upon instantiation of a batch of actors */
+using create_actors_t = message_t<payload::create_actors_t>;
+
 // registry-related
 /** \brief name/address registration request */
 using registration_request_t = request_traits_t<payload::registration_request_t>::request::message_t;
@@ -7,7 +7,9 @@
 //
 
 #include "plugin_base.h"
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace rotor::plugin {
 
@@ -35,6 +37,9 @@ struct child_manager_plugin_t : public plugin_base_t {
     /** \brief pre-initializes child and sends create_child message to the supervisor */
     virtual void create_child(const actor_ptr_t &actor) noexcept;
 
+    /** \brief pre-initializes children and sends single create_actors message to the supervisor */
+    virtual void create_children(std::vector<actor_ptr_t> &&actors) noexcept;
+
     /** \brief removes the child from the supervisor
      *
      * If there was an error, the supervisor might trigger shutdown self (in accordance with policy)
@@ -52,6 +57,13 @@ struct child_manager_plugin_t : public plugin_base_t {
     /** \brief sends initialization request upon actor creation message */
     virtual void on_create(message::create_actor_t &message) noexcept;
 
+    /** \brief sends initialization requests upon batch actors creation message
+     *
+     * The requests are guarded by the single group timer.
+     *
+     */
+    virtual void on_create_batch(message::create_actors_t &message) noexcept;
+
     /** \brief reaction on (maybe unsuccessful) init confirmatinon
      *
      * Possibilities:
@@ -105,14 +117,35 @@ struct child_manager_plugin_t : public plugin_base_t {
         template <typename Actor> actor_state_t(Actor &&act) noexcept : actor{std::forward<Actor>(act)} {}
 
         bool initialized = false;
+
+        /** \brief whether the actor initialization has failed (i.e. it is not awaited anymore) */
+        bool init_failed = false;
+
         bool strated = false;
         request_state_t shutdown = request_state_t::NONE;
+
+        /** \brief timer id of initialization group, if the actor was spawned in batch */
+        request_id_t init_group = 0;
+    };
+
+    /** \brief pending init requests, which are guarded by the same timer */
+    struct init_group_t {
+        /** \brief ids of init requests of the group */
+        std::vector<request_id_t> requests;
+
+        /** \brief amount of group actors, which did not confirm initialization yet */
+        std::size_t pending;
     };
 
     bool has_initializing() const noexcept;
+    void mark_initialized(actor_state_t &actor_state) noexcept;
+    void mark_init_failed(actor_state_t &actor_state) noexcept;
+    void mark_shutdown(actor_state_t &actor_state, request_state_t value) noexcept;
     void init_continue() noexcept;
     void request_shutdown() noexcept;
     void cancel_init(const actor_base_t *child) noexcept;
+    void leave_init_group(actor_state_t &actor_state) noexcept;
+    void on_init_group_timer(request_id_t timer_id, bool cancelled) noexcept;
     void request_shutdown(actor_state_t &actor_state) noexcept;
 
     using actors_map_t = std::unordered_map<address_ptr_t, actor_state_t>;
@@ -123,6 +156,15 @@ struct child_manager_plugin_t : public plugin_base_t {
     bool postponed_init = false;
     /** \brief local address to local actor (intrusive pointer) mapping */
     actors_map_t actors_map;
+
+    /** \brief group timer id to the group of init requests mapping */
+    std::unordered_map<request_id_t, init_group_t> init_groups;
+
+    /** \brief amount of child actors, which are not initialized yet, and which have not failed */
+    std::size_t initializing_count = 0;
+
+    /** \brief amount of actors (including self), to which shutdown is not requested yet */
+    std::size_t shutdown_unrequested_count = 0;
 };
 
 } // namespace rotor::plugin
@@ -0,0 +1,118 @@
+#pragma once
+
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "plugin_base.h"
+#include <unordered_map>
+#include <unordered_set>
+
+namespace rotor::plugin {
+
+/** \struct coroutine_plugin_t
+ *
+ * \brief resumes actor's coroutines, suspended on requests
+ *
+ * The plugin owns dedicated reply address of an actor: the responses
+ * to the requests, sent via `co_send` (see `rotor/coroutine.hpp`),
+ * are delivered there, and the suspended coroutine is resumed with
+ * the response message.
+ *
+ * The plugin also owns per-actor pool of coroutine frames, so, once
+ * a coroutine of some size was completed, the next one of the same
+ * size will reuse its memory. Up to `max_cached_frames` frames of the
+ * same size are kept, the excess ones are released.
+ *
+ * The plugin delays actor shutdown until all suspended coroutines
+ * are resumed; as each request is guarded with timeout timer, that
+ * is guaranteed to happen.
+ *
+ * The plugin is not included into the default actor plugins list,
+ * and it should be appended to the actor's `plugins_list_t`, if
+ * the actor uses coroutines.
+ *
+ */
+struct coroutine_plugin_t : public plugin_base_t {
+    using plugin_base_t::plugin_base_t;
+
+    /** \brief free function type, which resumes coroutine from its frame address */
+    using resumer_t = void (*)(void *frame) noexcept;
+
+    /** The plugin unique identity to allow further static_cast'ing*/
+    static const void *class_identity;
+
+    /** \brief the maximum amount of cached coroutine frames of the same size */
+    static constexpr std::size_t max_cached_frames = 16;
+
+    ~coroutine_plugin_t();
+
+    const void *identity() const noexcept override;
+
+    void activate(actor_base_t *actor) noexcept override;
+    bool handle_shutdown(message::shutdown_request_t *message) noexcept override;
+
+    /** \brief returns coroutine plugin of the actor, or `nullptr` if it is missing */
+    static coroutine_plugin_t *get(actor_base_t &actor) noexcept;
+
+    /** \brief returns address, where responses for the coroutines are delivered */
+    inline const address_ptr_t &get_reply_address() const noexcept { return reply_address; }
+
+    /** \brief subscribes coroutine resumer for the (response) message type
+     *
+     * The subscription happens only once per message type.
+     *
+     */
+    template <typename Message> void watch() noexcept;
+
+    /** \brief records suspended coroutine, which waits the response to the request
+     *
+     * Upon response arrival the message will be written to the `result` and the
+     * coroutine frame will be resumed via `resumer`.
+     *
+     */
+    void suspend(request_id_t request_id, void *frame, message_ptr_t &result, resumer_t resumer) noexcept;
+
+    /** \brief returns the amount of suspended coroutines */
+    inline std::size_t suspended() const noexcept { return waiters.size(); }
+
+    /** \brief takes memory block of the `size` bytes from the pool or allocates new one
+     *
+     * `nullptr` is returned, if the memory cannot be allocated.
+     *
+     */
+    void *allocate_frame(std::size_t size) noexcept;
+
+    /** \brief returns memory block of the `size` bytes back into pool, or releases it if the pool is full */
+    void deallocate_frame(void *frame, std::size_t size) noexcept;
+
+    /** \brief returns the amount of cached coroutine frames */
+    std::size_t cached_frames() const noexcept;
+
+  private:
+    struct waiter_t {
+        void *frame;
+        message_ptr_t *result;
+        resumer_t resumer;
+    };
+    using waiters_t = std::unordered_map<request_id_t, waiter_t>;
+    using watched_t = std::unordered_set<const void *>;
+    /* intrusive list of the released frames, the next frame pointer is stored in the frame itself */
+    struct frames_list_t {
+        void *head = nullptr;
+        std::size_t count = 0;
+    };
+    using frames_t = std::unordered_map<std::size_t, frames_list_t>;
+
+    template <typename Message> void on_reply(Message &message) noexcept;
+    void resume(request_id_t request_id, message_base_t &message) noexcept;
+
+    address_ptr_t reply_address;
+    waiters_t waiters;
+    watched_t watched;
+    frames_t frames;
+};
+
+} // namespace rotor::plugin
@@ -7,7 +7,11 @@
 //
 
 #include "plugin_base.h"
+#include "rotor/supervisor_stats.h"
+#include "rotor/watchdog.h"
+#include <atomic>
 #include <string>
+#include <type_traits>
 
 namespace rotor::plugin {
 
@@ -33,13 +37,48 @@ struct local_delivery_t {
 /** \struct inspected_local_delivery_t
  *
  * \brief debugging local message delivery implementation with dumping details to stdout.
+ *
+ * The messages with the inspection level not greater than the threshold are dumped.
+ * The threshold is read from the `ROTOR_INSPECT_DELIVERY` environment variable
+ * once, upon the first supervisor initialization, and it can be changed at runtime
+ * via `set_threshold()`. If the variable is not set, the inspection is disabled and
+ * the delivery costs just an atomic load more than `local_delivery_t`.
  */
 struct inspected_local_delivery_t {
-    /** \brief stringifies the message into human-readable debug form */
+    /** \brief the threshold value, which disables the inspection */
+    static constexpr std::int32_t disabled = -1;
+
+    /** \brief reads the threshold from the environment, unless it is already known */
+    static void init() noexcept;
+
+    /** \brief returns the current inspection threshold */
+    static inline std::int32_t get_threshold() noexcept { return current_threshold.load(std::memory_order_relaxed); }
+
+    /** \brief changes the inspection threshold (can be invoked from any thread) */
+    static inline void set_threshold(std::int32_t value) noexcept {
+        current_threshold.store(value, std::memory_order_relaxed);
+    }
+
+    /** \brief stringifies the message into human-readable debug form
+     *
+     * The empty string is returned if the message level is greater than the threshold.
+     */
     static std::string identify(message_base_t *message, int32_t threshold) noexcept;
 
     /** \brief delivers the message to the recipients, possbily dumping it to console */
-    static void delivery(message_ptr_t &message, const subscription_t::joint_handlers_t &local_recipients) noexcept;
+    static inline void delivery(message_ptr_t &message,
+                                const subscription_t::joint_handlers_t &local_recipients) noexcept {
+        auto value = get_threshold();
+        if (value > disabled) {
+            dump(message, value);
+        }
+        local_delivery_t::delivery(message, local_recipients);
+    }
+
+  private:
+    static constexpr std::int32_t unknown = -2;
+    static void dump(message_ptr_t &message, std::int32_t threshold) noexcept;
+    static std::atomic<std::int32_t> current_threshold;
 };
 
 #if defined(NDEBUG) || defined(ROTOR_DEBUG_DELIVERY)
@@ -61,6 +100,17 @@ struct delivery_plugin_base_t : public plugin_base_t {
     virtual void process() noexcept = 0;
     void activate(actor_base_t *actor) noexcept override;
 
+    /** \brief invokes the handler for the message
+     *
+     * This is the single place, where the handlers invocations are instrumented;
+     * each instrumentation is compiled in only with its build option, and it costs
+     * a pointer check at runtime, unless it is set up: the invocation is traced,
+     * if the message is traced (`ROTOR_TRACING`), it is marked for the watchdog, if
+     * any (`ROTOR_WATCHDOG`), and it is measured, if the handler's actor has
+     * `metrics_plugin_t` (`ROTOR_METRICS`).
+     */
+    static inline void invoke(handler_base_t &handler, message_ptr_t &message) noexcept;
+
   protected:
     /** \brief non-owning raw pointer of supervisor's messages queue */
     messages_queue_t *queue = nullptr;
@@ -70,6 +120,12 @@ struct delivery_plugin_base_t : public plugin_base_t {
 
     /** \brief non-owning raw pointer to supervisor's subscriptions map */
     subscription_t *subscription_map;
+
+    /** \brief non-owning raw pointer to supervisor's messages loop gauges */
+    rotor::details::supervisor_gauges_t *gauges = nullptr;
+
+    /** \brief non-owning raw pointer to system context slow handlers watchdog (if any) */
+    watchdog_t *watchdog = nullptr;
 };
 
 /** \brief templated message delivery plugin, to allow local message delivery be customized */
@@ -80,6 +136,13 @@ template <typename LocalDelivery = local_delivery_t> struct delivery_plugin_t :
     static const void *class_identity;
     const void *identity() const noexcept override { return class_identity; }
     void process() noexcept override;
+
+    void activate(actor_base_t *actor) noexcept override {
+        if constexpr (std::is_same_v<LocalDelivery, inspected_local_delivery_t>) {
+            inspected_local_delivery_t::init();
+        }
+        delivery_plugin_base_t::activate(actor);
+    }
 };
 
 template <typename LocalDelivery>
@@ -34,6 +34,8 @@ struct foreigners_support_plugin_t : public plugin_base_t {
     virtual void on_subscription_external(message::external_subscription_t &message) noexcept;
 
   private:
+    void commit_unsubscription(const subscription_point_t &point) noexcept;
+
     subscription_container_t foreign_points;
 };
 
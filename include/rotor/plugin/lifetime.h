@@ -43,6 +43,51 @@ struct lifetime_plugin_t : public plugin_base_t {
      */
     void unsubscribe(const subscription_info_ptr_t &info) noexcept;
 
+    /** \brief starts batching of subscription confirmations
+     *
+     * Until the (outermost) batch is committed, the confirmations of the actor
+     * subscriptions to the internal addresses are accumulated, and then they
+     * are sent to the actor as a single {@link message::subscription_t}
+     * message (instead of message per subscription). Batches can be nested.
+     *
+     * The plugin opens the batch upon activation, i.e. subscriptions of all
+     * the actor plugins are confirmed at once, when the actor commits the batch
+     * after plugins activation.
+     */
+    void begin_subscriptions() noexcept;
+
+    /** \brief commits the batch and, if it is the outermost one, sends the accumulated
+     * confirmations (if any) */
+    void commit_subscriptions() noexcept;
+
+    /** \brief records the subscription confirmation into the current batch
+     *
+     * Returns `false` if there is no open batch, i.e. the confirmation should
+     * be sent as usual.
+     */
+    bool batch_subscription(const subscription_point_t &point) noexcept;
+
+    /** \brief starts batching of unsubscriptions
+     *
+     * Until the (outermost) batch is committed, the actor unsubscriptions
+     * (from internal and external addresses) are accumulated, and then
+     * they are sent to the actor as a single {@link message::unsubscription_t}
+     * message (instead of message per unsubscription). Batches can be nested.
+     *
+     * When the batch is processed, the unsubscriptions from external addresses
+     * are committed with a single {@link message::commit_unsubscription_t} message
+     * per foreign supervisor.
+     */
+    void begin_unsubscriptions() noexcept;
+
+    /** \brief commits the batch and, if it is the outermost one, sends the accumulated
+     * unsubscriptions (if any) */
+    void commit_unsubscriptions() noexcept;
+
+    /** \brief sends unsubscription commit to the foreign supervisor of the point address,
+     * or records it, if the batch of unsubscriptions is being processed */
+    void commit_external(const subscription_point_t &point) noexcept;
+
     /** \brief reaction on subscription
      *
      * It just forwards it to the actor to poll related plugins
@@ -51,16 +96,11 @@ struct lifetime_plugin_t : public plugin_base_t {
 
     /** \brief reaction on unsubscription
      *
-     * It just forwards it to the actor to poll related plugins
+     * It forwards it to the actor to poll related plugins; the external
+     * unsubscriptions of the batch are committed grouped by foreign supervisors
      */
     virtual void on_unsubscription(message::unsubscription_t &) noexcept;
 
-    /** \brief reaction on external unsubscription
-     *
-     * It just forwards it to the actor to poll related plugins
-     */
-    virtual void on_unsubscription_external(message::unsubscription_external_t &) noexcept;
-
     bool handle_unsubscription(const subscription_point_t &point, bool external) noexcept override;
 
     bool handle_shutdown(message::shutdown_request_t *message) noexcept override;
@@ -74,6 +114,21 @@ struct lifetime_plugin_t : public plugin_base_t {
     /** \brief recorded subscription points (i.e. handler/address pairs) */
     subscription_container_t points;
 
+    /** \brief subscription confirmations of the current batch */
+    subscription_points_t batch;
+
+    /** \brief nesting level of the subscription confirmations batches */
+    std::uint32_t batch_level = 0;
+
+    /** \brief nesting level of the unsubscriptions batches */
+    std::uint32_t unsubscriptions_level = 0;
+
+    /** \brief unsubscriptions of the current batch, from internal and external addresses */
+    payload::unsubscription_confirmation_t unsubscriptions;
+
+    /** \brief external unsubscriptions commits, while the batch of unsubscriptions is processed */
+    subscription_points_t *external_commits = nullptr;
+
     bool ready_to_shutdown() noexcept;
 };
 
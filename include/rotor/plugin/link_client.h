@@ -89,6 +89,7 @@ struct link_client_plugin_t : public plugin_base_t {
     unlink_reaction_t unlink_reaction;
     unlink_queue_t unlink_queue;
     bool configured = false;
+    bool subscribed = false;
 };
 
 } // namespace rotor::plugin
@@ -23,6 +23,9 @@ namespace rotor::plugin {
  * connected clients will send unlink confirmation (or until
  * timeout will trigger).
  *
+ * Until the first client is linked, the plugin is subscribed to
+ * link requests only, and it does not participate in actor shutdown.
+ *
  */
 struct link_server_plugin_t : public plugin_base_t {
     using plugin_base_t::plugin_base_t;
@@ -64,7 +67,9 @@ struct link_server_plugin_t : public plugin_base_t {
     };
 
     using linked_clients_t = std::unordered_map<address_ptr_t, link_info_t>;
+    void on_first_client() noexcept;
     linked_clients_t linked_clients;
+    bool has_linked = false;
 };
 
 } // namespace rotor::plugin
@@ -0,0 +1,106 @@
+#pragma once
+
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "plugin_base.h"
+#include "rotor/histogram.h"
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+
+namespace rotor::plugin {
+
+/** \struct metrics_plugin_t
+ *
+ * \brief records per-actor and per-message-type handlers execution statistics
+ *
+ * The plugin is not included into the default actor plugins list, and it
+ * should be appended to the actor's `plugins_list_t`, if the actor is going
+ * to be observed.
+ *
+ * For each message type, handled by the actor, the amount of handled
+ * messages, handlers execution time histogram and the time of the message
+ * waiting in the queue histogram (all in nanoseconds) are recorded. The queue
+ * time is known only for the messages sent via supervisor, which has observed
+ * actors (see `supervisor_t::put`).
+ *
+ * The handlers, executed on the foreign supervisor (i.e. when the actor is
+ * subscribed to an address of other supervisor), are taken into account too;
+ * the ones, offloaded to the thread pool (`thread` backend), are not.
+ *
+ * The metrics should be read from the actor's thread (e.g. in the actor's
+ * handler or when the supervisor does not process messages).
+ *
+ * If `rotor` is built without `ROTOR_METRICS`, the plugin records nothing,
+ * and there is no overhead for non-observed actors at all.
+ *
+ */
+struct metrics_plugin_t : public plugin_base_t {
+    using plugin_base_t::plugin_base_t;
+
+    /** \brief clock, used for measurements */
+    using clock_t = std::chrono::steady_clock;
+
+    /** \struct message_metrics_t
+     * \brief statistics of the handling of the messages of the same type
+     */
+    struct message_metrics_t {
+        /** \brief the amount of handled messages */
+        std::uint64_t count = 0;
+
+        /** \brief handlers execution time histogram, in nanoseconds */
+        histogram_t handler_time;
+
+        /** \brief the time, spent by the messages in the queue, in nanoseconds */
+        histogram_t queue_time;
+    };
+
+    /** \brief message type to its statistics map */
+    using message_metrics_map_t = std::unordered_map<const void *, message_metrics_t>;
+
+    /** The plugin unique identity to allow further static_cast'ing*/
+    static const void *class_identity;
+
+    const void *identity() const noexcept override;
+
+    void activate(actor_base_t *actor) noexcept override;
+    void deactivate() noexcept override;
+
+    /** \brief returns metrics plugin of the actor, or `nullptr` if it is missing */
+    static metrics_plugin_t *get(actor_base_t &actor) noexcept;
+
+    /** \brief invokes the handler (of the observed actor) for the message, and records the invocation
+     *
+     * It is invoked by `delivery_plugin_base_t::invoke()`.
+     */
+    void call(handler_base_t &handler, message_ptr_t &message) noexcept;
+
+    /** \brief records the handler invocation */
+    void record(const void *message_type, const clock_t::time_point &started, const clock_t::time_point &finished,
+                const message_base_t &message) noexcept;
+
+    /** \brief returns the total amount of messages, handled by the actor */
+    inline std::uint64_t get_messages() const noexcept { return messages; }
+
+    /** \brief returns the total time, spent in the actor's handlers, in nanoseconds */
+    inline std::uint64_t get_handlers_time() const noexcept { return handlers_time; }
+
+    /** \brief returns the per-message-type statistics */
+    inline const message_metrics_map_t &get_message_metrics() const noexcept { return message_metrics; }
+
+    /** \brief forgets all recorded statistics */
+    void reset() noexcept;
+
+  private:
+    std::uint64_t messages = 0;
+    std::uint64_t handlers_time = 0;
+    message_metrics_map_t message_metrics;
+    message_metrics_t *last_metrics = nullptr;
+    const void *last_type = nullptr;
+};
+
+} // namespace rotor::plugin
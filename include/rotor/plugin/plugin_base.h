@@ -100,7 +100,7 @@ struct plugin_base_t {
      * will not be longer polled in future.
      *
      */
-    virtual bool handle_subscription(message::subscription_t &message) noexcept;
+    virtual bool handle_subscription(const subscription_point_t &point) noexcept;
 
     /** \brief polls plugin, whether it is done with unsubscription
      *
@@ -7,6 +7,7 @@
 //
 
 #include "plugin_base.h"
+#include <unordered_set>
 
 namespace rotor::plugin {
 
@@ -36,13 +37,14 @@ struct starter_plugin_t : public plugin_base_t {
 
     bool handle_init(message::init_request_t *) noexcept override;
     void handle_start(message::start_trigger_t *message) noexcept override;
-    bool handle_subscription(message::subscription_t &message) noexcept override;
+    bool handle_subscription(const subscription_point_t &point) noexcept override;
 
     /** \brief start mesage reaction */
     void on_start(message::start_trigger_t &message) noexcept;
 
   private:
-    subscription_container_t tracked;
+    /** \brief actor subscriptions, which are not confirmed yet */
+    std::unordered_set<subscription_point_t> tracked;
     bool configured = false;
 };
 
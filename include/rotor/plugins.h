@@ -8,10 +8,12 @@
 
 // actors plugins
 #include "plugin/address_maker.h"
+#include "plugin/coroutine.h"
 #include "plugin/init_shutdown.h"
 #include "plugin/lifetime.h"
 #include "plugin/link_client.h"
 #include "plugin/link_server.h"
+#include "plugin/metrics.h"
 #include "plugin/registry.h"
 #include "plugin/resources.h"
 #include "plugin/starter.h"
@@ -0,0 +1,82 @@
+#pragma once
+
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include <cstddef>
+
+namespace rotor {
+
+namespace details {
+
+/** \brief allocates memory block, reusing the previously recycled one (if any)
+ *
+ * The block size is rounded up to the pool size class, so it can be later recycled
+ * for an object of the same size class. The blocks, larger than the largest size
+ * class, are allocated and released as usual.
+ *
+ * The pool is a thread-local set of free lists (bounded per size class), which
+ * are released at thread exit.
+ */
+void *pool_allocate(std::size_t size);
+
+/** \brief recycles the memory block, if pooling is enabled on the current thread,
+ * otherwise the block is returned to the heap
+ */
+void pool_deallocate(void *ptr, std::size_t size) noexcept;
+
+/** \brief unconditionally recycles the memory block (unless the free list is full) */
+void pool_recycle(void *ptr, std::size_t size) noexcept;
+
+/** \brief returns the amount of recycled memory blocks of the current thread */
+std::size_t pool_cached() noexcept;
+
+/** \struct pool_scope_t
+ *  \brief enables (if requested) memory blocks recycling on the current thread, while it is alive
+ */
+struct pool_scope_t {
+    /** \brief enables recycling on the current thread, if `enabled` is true */
+    explicit pool_scope_t(bool enabled) noexcept;
+
+    /** \brief restores the previous recycling state on the current thread */
+    ~pool_scope_t();
+
+    pool_scope_t(const pool_scope_t &) = delete;
+    pool_scope_t(pool_scope_t &&) = delete;
+
+  private:
+    bool enabled;
+};
+
+} // namespace details
+
+/** \struct pool_allocated_t
+ *  \brief base class, which routes memory allocation of the descendants via recycling pool
+ *
+ * It is intended for the short-lived actors, i.e. the actor class should
+ * explicitly opt in (addresses, handlers and subscription infos are always
+ * allocated via the pool):
+ *
+ * \code
+ * struct my_actor_t: r::actor_base_t, r::pool_allocated_t { ... };
+ * \endcode
+ *
+ * The memory of the objects is recycled on the thread, which releases
+ * the objects, only if the supervisor has the `pool` option enabled. Otherwise,
+ * it is returned to the heap.
+ *
+ * Only memory is recycled; an object is always constructed (and destroyed)
+ * as usual.
+ */
+struct pool_allocated_t {
+    /** \brief allocates memory block for an object via pool */
+    static void *operator new(std::size_t size) { return details::pool_allocate(size); }
+
+    /** \brief recycles or releases memory block of an object */
+    static void operator delete(void *ptr, std::size_t size) noexcept { details::pool_deallocate(ptr, size); }
+};
+
+} // namespace rotor
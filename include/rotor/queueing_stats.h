@@ -0,0 +1,60 @@
+#pragma once
+
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "histogram.h"
+#include <cstdint>
+#include <unordered_map>
+
+namespace rotor {
+
+/** \brief message type (see `message_t::message_type`) to its queueing delay histogram map */
+using queueing_delay_map_t = std::unordered_map<const void *, histogram_t>;
+
+/** \struct queueing_stats_t
+ *  \brief queueing delay statistics of the messages, delivered to the supervisor's actors
+ *
+ * The queueing delay is the time between the first message enqueuing (via
+ * `supervisor_t::put()` or `supervisor_t::enqueue()`) and its dispatching
+ * to the handlers, i.e. it includes the time the message spent in the inbound
+ * queue and in the locality queue, and, if it was forwarded to the other
+ * locality, in the queues of both localities.
+ *
+ * The high queueing delay with fast handlers means the locality is overloaded;
+ * the low queueing delay with the high handlers execution time (see `metrics_plugin_t`)
+ * means the handlers are slow.
+ *
+ * All times are in nanoseconds.
+ *
+ */
+struct queueing_stats_t {
+    /** \brief queueing delay histogram of all messages */
+    histogram_t delay;
+
+    /** \brief per-message-type queueing delay histograms */
+    queueing_delay_map_t per_type;
+
+    /** \brief records the queueing delay of the message of the type */
+    inline void record(const void *message_type, std::uint64_t value) noexcept {
+        delay.record(value);
+        per_type[message_type].record(value);
+    }
+
+    /** \brief returns the queueing delay histogram of the message type, or `nullptr` if there were none */
+    inline const histogram_t *get(const void *message_type) const noexcept {
+        auto it = per_type.find(message_type);
+        return it != per_type.end() ? &it->second : nullptr;
+    }
+
+    /** \brief forgets all recorded delays */
+    inline void reset() noexcept {
+        delay.reset();
+        per_type.clear();
+    }
+};
+
+} // namespace rotor
@@ -10,6 +10,8 @@
 #include "message.h"
 #include "error_code.h"
 #include "forward.hpp"
+#include "request_stats.h"
+#include <chrono>
 #include <unordered_map>
 
 namespace rotor {
@@ -307,6 +309,14 @@ struct request_curry_t {
 
     /** \brief the original request message */
     message_ptr_t request_message;
+
+#ifdef ROTOR_ENABLE_METRICS
+    /** \brief the statistics of the request type, if the supervisor collects them */
+    request_stats_t *stats = nullptr;
+
+    /** \brief when the request has been sent (if the statistics is collected) */
+    std::chrono::steady_clock::time_point sent_at{};
+#endif
 };
 
 /** \struct request_traits_t
@@ -369,6 +379,8 @@ template <typename R> struct request_traits_t {
     }
 };
 
+template <typename T> struct request_awaiter_t;
+
 /** \struct request_builder_t
  * \brief builder pattern implentation for the original request
  */
@@ -386,6 +398,26 @@ template <typename T> struct [[nodiscard]] request_builder_t {
      */
     request_id_t send(pt::time_duration send) noexcept;
 
+    /** \brief actually dispatches requests without spawning timeout timer
+     *
+     * The request id of the dispatched request is returned. The caller
+     * is responsible for timing out the request, i.e. the request stays
+     * pending until response arrives or it is discarded by the supervisor.
+     *
+     * It is used to guard a group of requests by a single timer.
+     *
+     */
+    request_id_t send_untimed() noexcept;
+
+    /** \brief returns awaitable, which dispatches request upon coroutine suspension
+     *
+     * The response is delivered to the coroutine instead of the actor's
+     * response handler. It is available only with C++20 coroutines,
+     * see `rotor/coroutine.hpp`.
+     *
+     */
+    request_awaiter_t<T> co_send(pt::time_duration timeout) noexcept;
+
   private:
     using traits_t = request_traits_t<T>;
     using request_message_t = typename traits_t::request::message_t;
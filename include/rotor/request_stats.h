@@ -0,0 +1,54 @@
+#pragma once
+
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "histogram.h"
+#include <cstdint>
+#include <unordered_map>
+
+namespace rotor {
+
+/** \struct request_stats_t
+ *  \brief round-trip statistics of the requests of the same type, made via supervisor
+ *
+ * The request is finished either by the response, or by the timeout, or it
+ * is cancelled (i.e. discarded without response, e.g. upon shutdown).
+ *
+ */
+struct request_stats_t {
+    /** \brief the amount of sent requests */
+    std::uint64_t sent = 0;
+
+    /** \brief the amount of requests, finished by the response */
+    std::uint64_t responded = 0;
+
+    /** \brief the amount of requests, finished by the timeout */
+    std::uint64_t timed_out = 0;
+
+    /** \brief the amount of requests, finished without response or timeout */
+    std::uint64_t cancelled = 0;
+
+    /** \brief the current amount of not finished requests */
+    std::uint64_t in_flight = 0;
+
+    /** \brief round-trip time (from request sending to response delivery) histogram, in nanoseconds */
+    histogram_t round_trip;
+
+    /** \brief the amount of not finished requests (including the sent one) upon each request sending */
+    histogram_t in_flight_depth;
+
+    /** \brief returns the share (0..1) of timed out requests among the responded and timed out ones */
+    inline double timeout_rate() const noexcept {
+        auto finished = responded + timed_out;
+        return finished ? static_cast<double>(timed_out) / finished : 0.0;
+    }
+};
+
+/** \brief request message type (see `message_t::message_type`) to its statistics map */
+using request_stats_map_t = std::unordered_map<const void *, request_stats_t>;
+
+} // namespace rotor
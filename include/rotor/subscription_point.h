@@ -10,6 +10,8 @@
 #include "rotor/address.hpp"
 #include <vector>
 #include <list>
+#include <optional>
+#include <unordered_map>
 
 namespace rotor {
 
@@ -18,6 +20,7 @@ struct actor_base_t;
 namespace tags {
 
 extern const void *io;
+extern const void *io_offload;
 
 }
 
@@ -69,10 +72,50 @@ struct subscription_point_t {
     bool operator==(const subscription_point_t &other) const noexcept;
 };
 
+/** \struct subscription_points_t
+ *  \brief sequence of {@link subscription_point_t}, which keeps a single point inline
+ *
+ * The points are moved to the heap only when the second point is appended, i.e.
+ * a single (un)subscription does not allocate, while a batch of them costs
+ * one vector.
+ */
+struct subscription_points_t {
+    /** \brief constant iterator type */
+    using const_iterator = const subscription_point_t *;
+
+    /** \brief constructs empty sequence */
+    subscription_points_t() noexcept = default;
+
+    /** \brief constructs the sequence with the single point */
+    subscription_points_t(const subscription_point_t &point) noexcept : single{point} {}
+
+    /** \brief appends the point into the end */
+    void emplace_back(const subscription_point_t &point) noexcept;
+
+    /** \brief removes all points */
+    void clear() noexcept;
+
+    /** \brief returns true if there are no points */
+    inline bool empty() const noexcept { return !single && spilled.empty(); }
+
+    /** \brief returns the amount of points */
+    inline std::size_t size() const noexcept { return single ? 1 : spilled.size(); }
+
+    /** \brief iterator to the first point */
+    inline const_iterator begin() const noexcept { return single ? &*single : spilled.data(); }
+
+    /** \brief iterator past the last point */
+    inline const_iterator end() const noexcept { return begin() + size(); }
+
+  private:
+    std::optional<subscription_point_t> single;
+    std::vector<subscription_point_t> spilled;
+};
+
 /** \struct subscription_info_t
  *  \brief {@link subscription_point_t} with extended information (e.g. state)
  */
-struct subscription_info_t : public arc_base_t<subscription_info_t>, subscription_point_t {
+struct subscription_info_t : public arc_base_t<subscription_info_t>, subscription_point_t, pool_allocated_t {
     /** \brief subscription info state (subscribing, established, unsubscribing */
     enum state_t { SUBSCRIBING, ESTABLISHED, UNSUBSCRIBING };
 
@@ -95,6 +138,14 @@ struct subscription_info_t : public arc_base_t<subscription_info_t>, subscriptio
      */
     inline void tag_io() noexcept { tag(tags::io); }
 
+    /** \brief marks handler for blocking operations, which does not use `send()`
+     *
+     * The handler posts its results only via thread-safe `supervisor_t::enqueue()`,
+     * hence it can be executed on the I/O thread pool of the thread backend.
+     *
+     */
+    inline void tag_io_offload() noexcept { tag(tags::io_offload); }
+
     /** \brief generic non-public fields accessor */
     template <typename T> auto &access() noexcept;
 
@@ -117,12 +168,97 @@ struct subscription_info_t : public arc_base_t<subscription_info_t>, subscriptio
 /** \brief intrusive pointer for {@link subscription_info_t} */
 using subscription_info_ptr_t = intrusive_ptr_t<subscription_info_t>;
 
+} // namespace rotor
+
+namespace std {
+/** \struct hash<rotor::subscription_point_t>
+ *  \brief Hash calculator for subscription point (consistent with the point comparison)
+ */
+template <> struct hash<rotor::subscription_point_t> {
+    /** \brief Calculates hash for the subscription point (by handler and address) */
+    size_t operator()(const rotor::subscription_point_t &point) const noexcept;
+};
+} // namespace std
+
+namespace rotor {
+
 /** \struct subscription_container_t
  *  \brief list of {@link subscription_info_ptr_t} with possibility to find via {@link subscription_point_t}
+ *
+ * The insertion order is preserved. When the container grows above
+ * `index_threshold` items, the lookup is performed via hash index,
+ * otherwise it is a linear scan (which is faster for few items and
+ * does not allocate). In both cases, if there are a few items with
+ * the same subscription point, the last inserted one is found.
  */
-struct subscription_container_t : public std::list<subscription_info_ptr_t> {
-    /** \brief looks up for the subscription info pointer (returned as iterator) via the subscription point */
+struct subscription_container_t {
+    /** \brief the underlying list of subscription infos */
+    using list_t = std::list<subscription_info_ptr_t>;
+
+    /** \brief iterator type */
+    using iterator = list_t::iterator;
+
+    /** \brief reverse iterator type */
+    using reverse_iterator = list_t::reverse_iterator;
+
+    /** \brief the amount of items, above which the lookup index is maintained */
+    static constexpr std::size_t index_threshold = 16;
+
+    /** \brief appends subscription info into the end */
+    void emplace_back(const subscription_info_ptr_t &info) noexcept;
+
+    /** \brief removes subscription info, returns the iterator following it */
+    iterator erase(iterator it) noexcept;
+
+    /** \brief looks up for the last inserted subscription info pointer (returned as iterator)
+     * via the subscription point */
     iterator find(const subscription_point_t &point) noexcept;
+
+    /** \brief removes all subscription infos */
+    void clear() noexcept;
+
+    /** \brief returns true if there are no subscription infos */
+    inline bool empty() const noexcept { return items.empty(); }
+
+    /** \brief returns the amount of subscription infos */
+    inline std::size_t size() const noexcept { return items.size(); }
+
+    /** \brief iterator to the first subscription info */
+    inline iterator begin() noexcept { return items.begin(); }
+
+    /** \brief iterator past the last subscription info */
+    inline iterator end() noexcept { return items.end(); }
+
+    /** \brief reverse iterator to the last subscription info */
+    inline reverse_iterator rbegin() noexcept { return items.rbegin(); }
+
+    /** \brief reverse iterator before the first subscription info */
+    inline reverse_iterator rend() noexcept { return items.rend(); }
+
+  private:
+    struct point_hash_t {
+        inline size_t operator()(const subscription_point_t *point) const noexcept {
+            return std::hash<subscription_point_t>()(*point);
+        }
+    };
+
+    struct point_eq_t {
+        inline bool operator()(const subscription_point_t *lhs, const subscription_point_t *rhs) const noexcept {
+            return *lhs == *rhs;
+        }
+    };
+
+    /* the insertion sequence number allows to find the last one among the equal points */
+    struct indexed_t {
+        iterator it;
+        std::size_t seq;
+    };
+
+    using index_t = std::unordered_multimap<const subscription_point_t *, indexed_t, point_hash_t, point_eq_t>;
+
+    list_t items;
+    index_t index;
+    std::size_t next_seq = 0;
 };
 
 } // namespace rotor
@@ -13,10 +13,13 @@
 #include "subscription.h"
 #include "system_context.h"
 #include "supervisor_config.h"
-#include "address_mapping.h"
+#include "supervisor_stats.h"
+#include "queueing_stats.h"
 
+#include <atomic>
 #include <functional>
 #include <unordered_map>
+#include <vector>
 
 namespace rotor {
 
@@ -114,7 +117,10 @@ struct supervisor_t : public actor_base_t {
      * The method should be invoked in event-loop context only.
      *
      */
-    inline void do_process() noexcept { delivery->process(); }
+    inline void do_process() noexcept {
+        details::pool_scope_t scope{locality_leader->pool};
+        delivery->process();
+    }
 
     /** \brief creates new {@link address_t} linked with the supervisor */
     virtual address_ptr_t make_address() noexcept;
@@ -164,7 +170,17 @@ struct supervisor_t : public actor_base_t {
      * a new message from external context in thread-safe way.
      *
      */
-    inline void put(message_ptr_t message) { locality_leader->queue.emplace_back(std::move(message)); }
+    inline void put(message_ptr_t message) {
+#ifdef ROTOR_ENABLE_METRICS
+        stamp(*message);
+#endif
+#ifdef ROTOR_ENABLE_TRACING
+        if (auto tracer = context->tracer.get(); tracer) {
+            tracer->on_enqueue(*message);
+        }
+#endif
+        locality_leader->queue.emplace_back(std::move(message));
+    }
 
     /** \brief templated version of `subscribe_actor` */
     template <typename Handler> void subscribe(actor_base_t &actor, Handler &&handler) {
@@ -184,6 +200,41 @@ struct supervisor_t : public actor_base_t {
         return builder_t([this](auto &actor) { manager->create_child(actor); }, this);
     }
 
+    /** \brief creates `count` identically configured child-actors at once
+     *
+     * The `configurer` is invoked with fresh actor builder for each of the actors,
+     * and it should return the finished actor, i.e.
+     *
+     * ```
+     * sup->spawn_n<worker_t>(100, [&](auto builder) { return std::move(builder).timeout(t).finish(); });
+     * ```
+     *
+     * Unlike `create_actor`, the whole batch is announced to the supervisor via
+     * single message, and the initialization of the batch is guarded by
+     * single timer, i.e. by the group deadline.
+     *
+     * The successfully created actors are returned.
+     */
+    template <typename Actor, typename Configurer>
+    std::vector<intrusive_ptr_t<Actor>> spawn_n(std::size_t count, Configurer &&configurer) {
+        using builder_t = typename Actor::template config_builder_t<Actor>;
+        assert(manager && "child_manager_plugin_t should be already initialized");
+        std::vector<intrusive_ptr_t<Actor>> actors;
+        std::vector<actor_ptr_t> children;
+        actors.reserve(count);
+        children.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            auto actor = configurer(builder_t([&children](auto &actor) { children.emplace_back(actor); }, this));
+            if (actor) {
+                actors.emplace_back(std::move(actor));
+            }
+        }
+        if (!children.empty()) {
+            manager->create_children(std::move(children));
+        }
+        return actors;
+    }
+
     /** \brief convenient method for request building
      *
      * The built request isn't sent immediately, but only after invoking `send(timeout)`
@@ -199,7 +250,9 @@ struct supervisor_t : public actor_base_t {
      *
      * The subscription point is materialized inot subscription info. If address is
      * internal/local, then it is immediately confirmed to the source actor as
-     * {@link payload::subscription_confirmation_t}.
+     * {@link payload::subscription_confirmation_t}, or it is recorded into the
+     * actor's batch of confirmations, if the batch is open (see
+     * {@link plugin::lifetime_plugin_t::begin_subscriptions}).
      *
      * Otherwise, if the address is external (foreign), then subscription request
      * is forwarded to approriate supervisor as {@link payload::external_subscription_t}
@@ -216,6 +269,45 @@ struct supervisor_t : public actor_base_t {
     /** \brief returns registry actor address (if it was defined or registry actor was created) */
     inline const address_ptr_t &get_registry_address() const noexcept { return registry_address; }
 
+    /** \brief returns snapshot of the supervisor's messages loop gauges
+     *
+     * It is safe to invoke the method from any thread, while the supervisor
+     * is processing messages.
+     *
+     */
+    inline supervisor_stats_t get_stats() const noexcept { return gauges.snapshot(); }
+
+    /** \brief returns per-request-type round-trip statistics of the requests, made via the supervisor
+     *
+     * The statistics is collected only if the supervisor has been created with
+     * the `request_stats` option (and `rotor` is built with `ROTOR_METRICS`).
+     * It should be read from the supervisor's thread.
+     *
+     */
+    inline const request_stats_map_t &get_request_stats() const noexcept { return request_stats; }
+
+    /** \brief returns round-trip statistics of the requests of the type, or `nullptr` if there were none */
+    template <typename Request> const request_stats_t *get_request_stats() const noexcept {
+        using message_t = typename request_traits_t<Request>::request::message_t;
+        auto it = request_stats.find(message_t::message_type);
+        return it != request_stats.end() ? &it->second : nullptr;
+    }
+
+    /** \brief forgets the requests round-trip statistics (except the amount of requests in flight) */
+    void reset_request_stats() noexcept;
+
+    /** \brief returns queueing delay statistics of the messages, delivered to the supervisor's actors
+     *
+     * The statistics is collected only if the supervisor has been created with
+     * the `queueing_stats` option (and `rotor` is built with `ROTOR_METRICS`).
+     * It should be read from the supervisor's thread.
+     *
+     */
+    inline const queueing_stats_t &get_queueing_stats() const noexcept { return queueing_stats; }
+
+    /** \brief forgets the recorded messages queueing delays */
+    inline void reset_queueing_stats() noexcept { queueing_stats.reset(); }
+
     /** \brief generic non-public fields accessor */
     template <typename T> auto &access() noexcept;
 
@@ -241,6 +333,20 @@ struct supervisor_t : public actor_base_t {
     /** \brief intercepts message delivery for the tagged handler */
     virtual void intercept(message_ptr_t &message, const void *tag, const continuation_t &continuation) noexcept;
 
+#ifdef ROTOR_ENABLE_METRICS
+    /** \brief timestamps the message upon its first enqueuing, if the destination supervisor needs that
+     *
+     * The backends invoke it in `enqueue()`, to have the queueing delay including the inbound queue.
+     */
+    static inline void stamp(message_base_t &message) noexcept {
+        auto &sup = message.address->supervisor;
+        if (message.enqueued_at == std::chrono::steady_clock::time_point{} &&
+            (sup.collect_queueing_stats || sup.observed_actors.load(std::memory_order_relaxed))) {
+            message.enqueued_at = std::chrono::steady_clock::now();
+        }
+    }
+#endif
+
     /** \brief non-owning pointer to system context. */
     system_context_t *context;
 
@@ -253,6 +359,12 @@ struct supervisor_t : public actor_base_t {
     /** \brief timer to response with timeout procuder */
     request_map_t request_map;
 
+    /** \brief per-request-type round-trip statistics */
+    request_stats_map_t request_stats;
+
+    /** \brief queueing delay statistics of the delivered messages */
+    queueing_stats_t queueing_stats;
+
     /** \brief main subscription support class  */
     subscription_t subscription_map;
 
@@ -268,15 +380,28 @@ struct supervisor_t : public actor_base_t {
     /** \brief root supervisor for the locality */
     supervisor_t *locality_leader;
 
+    /** \brief messages loop gauges */
+    details::supervisor_gauges_t gauges;
+
+    /** \brief root supervisor of the supervisors tree, i.e. the default address locality */
+    supervisor_t *root;
+
   private:
     bool create_registry;
     bool synchronize_start;
+    bool pool;
+    bool collect_request_stats;
+    bool collect_queueing_stats;
     address_ptr_t registry_address;
 
     supervisor_policy_t policy;
 
-    /** \brief per-actor and per-message request tracking support */
-    address_mapping_t address_mapping;
+    /** \brief amount of actors with non-empty request tracking support (`address_mapping`) */
+    std::size_t mapped_actors = 0;
+
+    /** \brief amount of actors with metrics plugin; if there are any, the messages
+     * for the supervisor are timestamped */
+    std::atomic<std::uint32_t> observed_actors{0};
 
     template <typename T> friend struct request_builder_t;
     template <typename Supervisor> friend struct actor_config_builder_t;
@@ -284,7 +409,16 @@ struct supervisor_t : public actor_base_t {
     friend struct actor_base_t;
     template <typename T> friend struct plugin::delivery_plugin_t;
 
-    void discard_request(request_id_t request_id) noexcept;
+    void discard_request(request_id_t request_id, bool responded = false) noexcept;
+
+#ifdef ROTOR_ENABLE_METRICS
+    void record_queueing(message_base_t &message) noexcept;
+#endif
+
+#ifdef ROTOR_ENABLE_METRICS
+    void track_request(request_curry_t &curry) noexcept;
+    void untrack_request(request_curry_t &curry, std::uint64_t request_stats_t::*outcome) noexcept;
+#endif
 
     inline request_id_t next_request_id() noexcept {
         request_map_t::iterator it;
@@ -354,6 +488,39 @@ subscription_info_ptr_t actor_base_t::subscribe(Handler &&h, const address_ptr_t
 
 namespace plugin {
 
+inline void delivery_plugin_base_t::invoke(handler_base_t &handler, message_ptr_t &message) noexcept {
+#ifdef ROTOR_ENABLE_TRACING
+    auto tracer = message->tracer;
+    if (tracer) {
+        tracer->record(trace_point_t::handler_begin, *message, handler.actor_ptr->get_address().get());
+    }
+#endif
+#ifdef ROTOR_ENABLE_WATCHDOG
+    auto slot = rotor::details::watchdog_slot;
+    bool watched =
+        slot && slot->begin(handler.actor_ptr->get_address().get(), handler.message_type, handler.handler_type);
+#endif
+#ifdef ROTOR_ENABLE_METRICS
+    if (auto metrics = handler.actor_ptr->metrics; metrics) {
+        metrics->call(handler, message);
+    } else {
+        handler.call(message);
+    }
+#else
+    handler.call(message);
+#endif
+#ifdef ROTOR_ENABLE_WATCHDOG
+    if (watched) {
+        slot->end();
+    }
+#endif
+#ifdef ROTOR_ENABLE_TRACING
+    if (tracer) {
+        tracer->record(trace_point_t::handler_end, *message);
+    }
+#endif
+}
+
 template <typename Handler>
 subscription_info_ptr_t plugin_base_t::subscribe(Handler &&h, const address_ptr_t &addr) noexcept {
     using final_handler_t = handler_t<Handler>;
@@ -378,20 +545,47 @@ template <typename Handler>
 subscription_info_ptr_t starter_plugin_t::subscribe_actor(Handler &&handler, const address_ptr_t &addr) noexcept {
     auto wrapped_handler = wrap_handler(*actor, std::move(handler));
     auto info = actor->get_supervisor().subscribe(wrapped_handler, addr, actor, owner_tag_t::PLUGIN);
-    assert(std::count_if(tracked.begin(), tracked.end(), [&](auto &it) { return *it == *info; }) == 0 &&
-           "already subscribed");
-    tracked.emplace_back(info);
+    auto inserted = tracked.emplace(*info).second;
+    assert(inserted && "already subscribed");
+    (void)inserted;
     access<starter_plugin_t>().emplace_back(info);
     return info;
 }
 
 template <typename LocalDelivery> void delivery_plugin_t<LocalDelivery>::process() noexcept {
-    while (queue->size()) {
+#ifdef ROTOR_ENABLE_METRICS
+    using clock_t = std::chrono::steady_clock;
+    auto started = clock_t::now();
+    std::uint64_t processed = 0;
+    std::uint64_t cross_enqueued = 0;
+    std::size_t high_water = 0;
+#endif
+#ifdef ROTOR_ENABLE_WATCHDOG
+    rotor::details::watchdog_scope_t watchdog_scope{watchdog};
+#endif
+    while (auto size = queue->size()) {
+#ifdef ROTOR_ENABLE_METRICS
+        ++processed;
+        if (size > high_water) {
+            high_water = size;
+        }
+#endif
         auto message = queue->front();
+#ifdef ROTOR_ENABLE_TRACING
+        if (message->tracer) {
+            message->tracer->record(trace_point_t::dispatch, *message);
+        }
+#endif
         auto &dest = message->address;
         queue->pop_front();
         auto &dest_sup = dest->supervisor;
         auto internal = &dest_sup == actor;
+#ifdef ROTOR_ENABLE_METRICS
+        if (dest_sup.collect_queueing_stats && message->enqueued_at != clock_t::time_point{} &&
+            (internal || dest_sup.address->same_locality(*address))) {
+            dest_sup.record_queueing(*message);
+        }
+#endif
         if (internal) { /* subscriptions are handled by me */
             auto *local_recipients = subscription_map->get_recipients(*message);
             if (local_recipients) {
@@ -403,9 +597,22 @@ template <typename LocalDelivery> void delivery_plugin_t<LocalDelivery>::process
                 LocalDelivery::delivery(message, *local_recipients);
             }
         } else {
+#ifdef ROTOR_ENABLE_METRICS
+            ++cross_enqueued;
+#endif
             dest_sup.enqueue(std::move(message));
         }
     }
+#ifdef ROTOR_ENABLE_METRICS
+    using G = rotor::details::supervisor_gauges_t;
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_t::now() - started).count();
+    G::add(gauges->process_calls, 1);
+    G::add(gauges->processed, processed);
+    G::add(gauges->process_time, static_cast<std::uint64_t>(elapsed));
+    G::add(gauges->cross_enqueued, cross_enqueued);
+    G::raise(gauges->max_processed, processed);
+    G::raise(gauges->queue_high_water, high_water);
+#endif
 }
 
 } // namespace plugin
@@ -425,9 +632,9 @@ request_builder_t<T>::request_builder_t(supervisor_t &sup_, actor_base_t &actor_
                                         const address_ptr_t &reply_to_, Args &&...args)
     : sup{sup_}, actor{actor_}, request_id{sup.next_request_id()}, destination{destination_}, reply_to{reply_to_},
       do_install_handler{false} {
-    auto addr = sup.address_mapping.get_mapped_address(actor_, response_message_t::message_type);
+    auto addr = actor_.address_mapping.get_mapped_address(response_message_t::message_type);
     if (addr) {
-        imaginary_address = addr;
+        imaginary_address = *addr;
     } else {
         // subscribe to imaginary address instead of real one because of
         // 1. faster dispatching
@@ -440,13 +647,25 @@ request_builder_t<T>::request_builder_t(supervisor_t &sup_, actor_base_t &actor_
 }
 
 template <typename T> request_id_t request_builder_t<T>::send(pt::time_duration timeout) noexcept {
+    send_untimed();
+    sup.start_timer(request_id, timeout, sup, &supervisor_t::on_request_trigger);
+    return request_id;
+}
+
+template <typename T> request_id_t request_builder_t<T>::send_untimed() noexcept {
     if (do_install_handler) {
         install_handler();
     }
     auto fn = &request_traits_t<T>::make_error_response;
-    sup.request_map.emplace(request_id, request_curry_t{fn, reply_to, req});
+    auto &curry = sup.request_map.emplace(request_id, request_curry_t{fn, req->payload.origin, req}).first->second;
+#ifdef ROTOR_ENABLE_METRICS
+    if (sup.collect_request_stats) {
+        sup.track_request(curry);
+    }
+#else
+    (void)curry;
+#endif
     sup.put(req);
-    sup.start_timer(request_id, timeout, sup, &supervisor_t::on_request_trigger);
     return request_id;
 }
 
@@ -457,7 +676,7 @@ template <typename T> void request_builder_t<T>::install_handler() noexcept {
         if (it != supervisor->request_map.end()) {
             auto &orig_addr = it->second.origin;
             supervisor->template send<wrapped_res_t>(orig_addr, msg.payload);
-            supervisor->discard_request(request_id);
+            supervisor->discard_request(request_id, true);
         }
         // if a response to request has arrived and no timer can be found
         // that means that either timeout timer already triggered
@@ -466,7 +685,9 @@ template <typename T> void request_builder_t<T>::install_handler() noexcept {
     });
     auto wrapped_handler = wrap_handler(sup, std::move(handler));
     auto info = sup.subscribe(wrapped_handler, imaginary_address, &actor, owner_tag_t::SUPERVISOR);
-    sup.address_mapping.set(actor, info);
+    if (actor.address_mapping.set(info)) {
+        ++sup.mapped_actors;
+    }
 }
 
 /** \brief makes an reqest to the destination address with the message constructed from `args`
@@ -28,6 +28,19 @@ struct supervisor_config_t : actor_config_t {
      * initialization, and only then send start signal to all of them */
     bool synchronize_start = false;
 
+    /** \brief whether memory of released actors, addresses, handlers and subscriptions
+     * should be recycled for the newly created ones */
+    bool pool = false;
+
+    /** \brief whether per-request-type round-trip statistics should be collected */
+    bool request_stats = false;
+
+    /** \brief whether the queueing delay of the delivered messages should be recorded
+     *
+     * The child supervisors inherit the option.
+     */
+    bool queueing_stats = false;
+
     /** \brief use the specified address of a registry
      *
      * Can be usesul if an registry was created on the different supervisors
@@ -64,6 +77,24 @@ template <typename Supervisor> struct supervisor_config_builder_t : actor_config
         return std::move(*static_cast<typename parent_t::builder_t *>(this));
     }
 
+    /** \brief instructs supervisor to recycle memory of released actors, addresses etc. */
+    builder_t &&pool(bool value = true) &&noexcept {
+        parent_t::config.pool = value;
+        return std::move(*static_cast<typename parent_t::builder_t *>(this));
+    }
+
+    /** \brief instructs supervisor to collect requests round-trip statistics, see `get_request_stats()` */
+    builder_t &&request_stats(bool value = true) &&noexcept {
+        parent_t::config.request_stats = value;
+        return std::move(*static_cast<typename parent_t::builder_t *>(this));
+    }
+
+    /** \brief instructs supervisor to record messages queueing delay, see `get_queueing_stats()` */
+    builder_t &&queueing_stats(bool value = true) &&noexcept {
+        parent_t::config.queueing_stats = value;
+        return std::move(*static_cast<typename parent_t::builder_t *>(this));
+    }
+
     /** \brief injects external registry address */
     builder_t &&registry_address(const address_ptr_t &value) &&noexcept {
         parent_t::config.registry_address = value;
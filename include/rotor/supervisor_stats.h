@@ -0,0 +1,119 @@
+#pragma once
+
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include <atomic>
+#include <cstdint>
+
+namespace rotor {
+
+/** \struct supervisor_stats_t
+ *  \brief snapshot of supervisor's messages loop gauges
+ *
+ * The messages loop gauges are meaningful for the supervisor, which actually
+ * processes the messages queue, i.e. for the locality leader. The `inbound`
+ * and `parked` gauges are filled only by the backends, which have inbound queue
+ * and wait for the events on their own (i.e. `thread` backend); otherwise
+ * they are zeroes.
+ *
+ * All times are in nanoseconds.
+ *
+ */
+struct supervisor_stats_t {
+    /** \brief the amount of `do_process()` invocations */
+    std::uint64_t process_calls = 0;
+
+    /** \brief the total amount of processed messages */
+    std::uint64_t processed = 0;
+
+    /** \brief the maximum amount of processed messages per single `do_process()` invocation */
+    std::uint64_t max_processed = 0;
+
+    /** \brief the total time, spent in messages processing */
+    std::uint64_t process_time = 0;
+
+    /** \brief the high-water mark of the (locality) messages queue depth */
+    std::uint64_t queue_high_water = 0;
+
+    /** \brief the amount of messages, forwarded to the supervisors of other localities */
+    std::uint64_t cross_enqueued = 0;
+
+    /** \brief the depth of the inbound queue, when it was drained last time */
+    std::uint64_t inbound_depth = 0;
+
+    /** \brief the high-water mark of the inbound queue depth */
+    std::uint64_t inbound_high_water = 0;
+
+    /** \brief the total time, the thread was parked while waiting for events */
+    std::uint64_t parked_time = 0;
+};
+
+namespace details {
+
+/** \struct supervisor_gauges_t
+ *  \brief supervisor's messages loop gauges
+ *
+ * The gauges are updated by the supervisor's thread only, while they can be
+ * read (see `snapshot()`) from any thread at any time.
+ *
+ */
+struct supervisor_gauges_t {
+    /** \brief alias for the single gauge */
+    using gauge_t = std::atomic<std::uint64_t>;
+
+    /** \brief the amount of `do_process()` invocations */
+    gauge_t process_calls{0};
+
+    /** \brief the total amount of processed messages */
+    gauge_t processed{0};
+
+    /** \brief the maximum amount of processed messages per single `do_process()` invocation */
+    gauge_t max_processed{0};
+
+    /** \brief the total time, spent in messages processing */
+    gauge_t process_time{0};
+
+    /** \brief the high-water mark of the (locality) messages queue depth */
+    gauge_t queue_high_water{0};
+
+    /** \brief the amount of messages, forwarded to the supervisors of other localities */
+    gauge_t cross_enqueued{0};
+
+    /** \brief the depth of the inbound queue, when it was drained last time */
+    gauge_t inbound_depth{0};
+
+    /** \brief the high-water mark of the inbound queue depth */
+    gauge_t inbound_high_water{0};
+
+    /** \brief the total time, the thread was parked while waiting for events */
+    gauge_t parked_time{0};
+
+    /** \brief increases the gauge by the value (the gauge has the single writer) */
+    static inline void add(gauge_t &gauge, std::uint64_t value) noexcept {
+        gauge.store(gauge.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    /** \brief raises the gauge up to the value, if it is greater (the gauge has the single writer) */
+    static inline void raise(gauge_t &gauge, std::uint64_t value) noexcept {
+        if (value > gauge.load(std::memory_order_relaxed)) {
+            gauge.store(value, std::memory_order_relaxed);
+        }
+    }
+
+    /** \brief records the amount of messages, drained from the inbound queue */
+    inline void record_inbound(std::uint64_t depth) noexcept {
+        inbound_depth.store(depth, std::memory_order_relaxed);
+        raise(inbound_high_water, depth);
+    }
+
+    /** \brief returns copy of the gauges */
+    supervisor_stats_t snapshot() const noexcept;
+};
+
+} // namespace details
+
+} // namespace rotor
@@ -9,6 +9,8 @@
 #include "address.hpp"
 #include "supervisor_config.h"
 #include "error_code.h"
+#include "tracer.h"
+#include "watchdog.h"
 #include <system_error>
 
 namespace rotor {
@@ -44,8 +46,32 @@ struct system_context_t : arc_base_t<system_context_t> {
      */
     virtual void on_error(const std::error_code &ec) noexcept;
 
+    /** \brief installs messages tracer
+     *
+     * The tracer should be installed before the root supervisor creation,
+     * and it should not be changed while the supervisors are running.
+     *
+     */
+    inline void set_tracer(tracer_ptr_t tracer_) noexcept { tracer = std::move(tracer_); }
+
+    /** \brief returns the installed messages tracer (if any) */
+    inline const tracer_ptr_t &get_tracer() const noexcept { return tracer; }
+
+    /** \brief installs slow handlers watchdog
+     *
+     * The watchdog should be installed before the root supervisor creation,
+     * and it should not be changed while the supervisors are running.
+     *
+     */
+    inline void set_watchdog(watchdog_ptr_t watchdog_) noexcept { watchdog = std::move(watchdog_); }
+
+    /** \brief returns the installed slow handlers watchdog (if any) */
+    inline const watchdog_ptr_t &get_watchdog() const noexcept { return watchdog; }
+
   private:
     friend struct supervisor_t;
+    tracer_ptr_t tracer;
+    watchdog_ptr_t watchdog;
     supervisor_ptr_t supervisor;
 };
 
@@ -7,13 +7,16 @@
 //
 
 #include "rotor/arc.hpp"
+#include "rotor/handler.h"
 #include "rotor/system_context.h"
 #include "rotor/timer_handler.hpp"
 #include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <list>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 namespace rotor {
 namespace thread {
@@ -26,10 +29,37 @@ using supervisor_ptr_t = intrusive_ptr_t<supervisor_thread_t>;
 /** \struct system_context_thread_t
  *  \brief The thread system context, for blocking operations
  *
+ * The context optionally owns bounded thread pool for blocking I/O: if
+ * `io_threads` is non-zero, then handlers, tagged as offloadable I/O (see
+ * `subscription_info_t::tag_io_offload()`), are executed on the pool threads,
+ * while the context thread continues messages processing. The handlers,
+ * tagged just as I/O (`subscription_info_t::tag_io()`), may use `send()`,
+ * hence they are never offloaded.
+ *
+ * The offloaded handler should be self-contained: it is allowed to
+ * read the message and to send new messages via thread-safe
+ * `supervisor_t::enqueue()`, but it should not use `send()`, touch actor
+ * state, shared with other handlers, start timers or make requests.
+ * Upon offloading, the resource (id `0`) of actor's
+ * {@link plugin::resources_plugin_t} (if the actor has it) is acquired,
+ * and it is released after handler completion, i.e. actor shutdown
+ * is delayed until all its offloaded handlers complete.
+ *
+ * If there are already `io_jobs_limit` handlers in flight, the new
+ * I/O handler is executed in the context thread, as if there is no
+ * pool at all.
+ *
+ * If `rotor` is built with thread-unsafe refcounting (`BUILD_THREAD_UNSAFE`),
+ * the pool is not started, and the I/O handlers are always executed in the
+ * context thread.
+ *
  */
 struct system_context_thread_t : public system_context_t {
-    /** \brief constructs thread system context */
-    system_context_thread_t() noexcept;
+    /** \brief constructs thread system context with optional I/O thread pool */
+    explicit system_context_thread_t(std::size_t io_threads = 0, std::size_t io_jobs_limit = 64) noexcept;
+
+    /** \brief stops and joins I/O thread pool (if any) */
+    ~system_context_thread_t();
 
     /** \brief invokes blocking execution of the supervisor
      *
@@ -62,6 +92,34 @@ struct system_context_thread_t : public system_context_t {
     /** \brief fires handlers for expired timers */
     void update_time() noexcept;
 
+    /** \brief I/O (offloaded) job, i.e. the tagged handler and the message for it */
+    struct io_job_t {
+        /** \brief the intercepted handler */
+        handler_ptr_t handler;
+
+        /** \brief message to be processed by the handler */
+        message_ptr_t message;
+    };
+
+    /** \brief queue of pending I/O jobs (type) */
+    using io_jobs_t = std::deque<io_job_t>;
+
+    /** \brief list of handlers of completed I/O jobs (type) */
+    using io_completions_t = std::vector<handler_ptr_t>;
+
+    /** \brief executes handler in the I/O thread pool
+     *
+     * Returns `false` when there is no thread pool or it is saturated.
+     *
+     */
+    bool offload(message_ptr_t &message, handler_base_t &handler) noexcept;
+
+    /** \brief moves inbound messages to the supervisor queue and finalizes completed I/O jobs */
+    void drain(std::unique_lock<std::mutex> &lock) noexcept;
+
+    /** \brief I/O thread pool main loop */
+    void io_loop() noexcept;
+
     /** \brief start timer implementation */
     void start_timer(const pt::time_duration &interval, timer_handler_base_t &handler) noexcept;
 
@@ -86,6 +144,30 @@ struct system_context_thread_t : public system_context_t {
     /** \brief whether the context is intercepting blocking (I/O) handler */
     bool intercepting = false;
 
+    /** \brief handlers of completed I/O jobs (guarded by `mutex`) */
+    io_completions_t io_completed;
+
+    /** \brief pending I/O jobs (guarded by `io_mutex`) */
+    io_jobs_t io_jobs;
+
+    /** \brief mutex for pending I/O jobs */
+    std::mutex io_mutex;
+
+    /** \brief cv for notifying I/O threads about new jobs */
+    std::condition_variable io_cv;
+
+    /** \brief I/O thread pool */
+    std::vector<std::thread> io_threads;
+
+    /** \brief max amount of I/O jobs in flight */
+    std::size_t io_jobs_limit;
+
+    /** \brief current amount of I/O jobs in flight (accessed only from the context thread) */
+    std::size_t io_in_flight = 0;
+
+    /** \brief whether I/O thread pool should be stopped (guarded by `io_mutex`) */
+    bool io_stop = false;
+
     friend struct supervisor_thread_t;
 };
 
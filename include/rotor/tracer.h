@@ -0,0 +1,253 @@
+#pragma once
+
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "arc.hpp"
+#include "message.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+
+namespace rotor {
+
+/** \brief the point of the message life, where the trace event is recorded */
+enum class trace_point_t : std::uint8_t {
+    /** \brief the message has been put into the supervisor's queue */
+    enqueue,
+    /** \brief the message has been taken from the queue by the supervisor */
+    dispatch,
+    /** \brief the message handler is going to be invoked */
+    handler_begin,
+    /** \brief the message handler has been invoked */
+    handler_end,
+};
+
+namespace details {
+
+/** \struct trace_ring_t
+ *  \brief single-producer single-consumer ring of trace events
+ *
+ * The ring is written by the owning thread only, and it is read by the
+ * `tracer_t::flush()`. When the ring is full, the new events are dropped.
+ *
+ */
+struct trace_ring_t {
+    /** \struct event_t
+     *  \brief recorded trace event
+     */
+    struct event_t {
+        /** \brief steady clock timestamp, in nanoseconds */
+        std::uint64_t timestamp;
+
+        /** \brief message type, see `message_t::message_type` */
+        const void *message_type;
+
+        /** \brief message destination address */
+        const void *address;
+
+        /** \brief the handler's actor address, or `nullptr` for `enqueue` and `dispatch` points */
+        const void *actor;
+
+        /** \brief the trace point */
+        trace_point_t point;
+    };
+
+    /** \brief allocates the ring of the specified capacity (rounded up to the power of 2) */
+    trace_ring_t(std::size_t capacity, std::uint32_t thread_id) noexcept;
+
+    /** \brief sequential thread identifier (i.e. `tid` in the trace) */
+    const std::uint32_t thread_id;
+
+    /** \brief the ring storage */
+    std::unique_ptr<event_t[]> events;
+
+    /** \brief capacity minus one */
+    const std::uint64_t mask;
+
+    /** \brief the amount of recorded events */
+    std::atomic<std::uint64_t> head{0};
+
+    /** \brief the last known to the producer amount of flushed events */
+    std::uint64_t cached_tail = 0;
+
+    /** \brief the amount of messages to be skipped until the next sampled one */
+    std::uint32_t countdown = 0;
+
+    /** \brief the amount of dropped (due to the ring overflow) events */
+    std::atomic<std::uint64_t> dropped{0};
+
+    /** \brief the amount of flushed events */
+    alignas(64) std::atomic<std::uint64_t> tail{0};
+
+    /** \brief whether the thread name has been written into the trace */
+    bool announced = false;
+
+    /** \brief appends the event to the ring, unless it is full */
+    inline void push(const event_t &event) noexcept {
+        auto h = head.load(std::memory_order_relaxed);
+        if (h - cached_tail > mask) {
+            cached_tail = tail.load(std::memory_order_acquire);
+            if (h - cached_tail > mask) {
+                dropped.store(dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                return;
+            }
+        }
+        events[h & mask] = event;
+        head.store(h + 1, std::memory_order_release);
+    }
+};
+
+/** \struct trace_ring_cache_t
+ *  \brief per-thread cached ring of the last used tracer
+ */
+struct trace_ring_cache_t {
+    /** \brief the unique tracer id */
+    std::uint64_t tracer_id = 0;
+
+    /** \brief the ring of the tracer for the current thread */
+    trace_ring_t *ring = nullptr;
+};
+
+/** \brief per-thread cached ring of the last used tracer */
+inline thread_local trace_ring_cache_t trace_ring_cache;
+
+} // namespace details
+
+/** \struct tracer_t
+ *  \brief low-overhead messages tracer, which writes Chrome/Perfetto trace
+ *
+ * The tracer records the messages `enqueue` and `dispatch` (instant events),
+ * and handlers invocations (duration events, named after the message type) into
+ * per-thread lock-free rings. The events are written into the trace file
+ * in JSON array format (which can be opened via `chrome://tracing` or
+ * https://ui.perfetto.dev ) by `flush()`. It is invoked periodically by the
+ * tracer's flushing thread (see `start()`), or it can be invoked manually from
+ * any thread; the rings are flushed on the tracer destruction too. The events,
+ * which do not fit into the ring between flushes, are dropped (see `get_dropped()`).
+ *
+ * The tracer is sampling: only each N-th message (per thread) is traced, and
+ * all the events of the traced message are recorded.
+ *
+ * The tracer is installed into the system context (`system_context_t::set_tracer`)
+ * before the root supervisor creation; it should outlive all the messages, i.e.
+ * it should be released only after the supervisors shutdown.
+ *
+ * If `rotor` is built without `ROTOR_TRACING`, nothing is traced.
+ *
+ */
+struct tracer_t : arc_base_t<tracer_t> {
+    /** \brief clock, used for timestamps */
+    using clock_t = std::chrono::steady_clock;
+
+    /** \brief trace event, see {@link details::trace_ring_t::event_t} */
+    using event_t = details::trace_ring_t::event_t;
+
+    /** \brief opens the trace file for writing
+     *
+     * Each `sampling`-th message is traced; each thread records up to `ring_capacity`
+     * events between flushes.
+     *
+     */
+    tracer_t(const std::string &path, std::uint32_t sampling = 1, std::size_t ring_capacity = 1 << 16) noexcept;
+
+    tracer_t(const tracer_t &) = delete;
+    tracer_t(tracer_t &&) = delete;
+
+    /** \brief stops the flushing thread (if any), flushes the remaining events and finalizes the trace file */
+    ~tracer_t();
+
+    /** \brief starts the thread, which flushes the recorded events each `interval`
+     *
+     * The error is returned, if the thread cannot be started.
+     *
+     */
+    std::error_code start(const clock_t::duration &interval) noexcept;
+
+    /** \brief returns `false` if the trace file cannot be written */
+    bool good() const noexcept;
+
+    /** \brief samples the message, and, if it is traced, records the `enqueue` event */
+    inline void on_enqueue(message_base_t &message) noexcept {
+#ifdef ROTOR_ENABLE_TRACING
+        auto &ring = get_ring();
+        if (message.tracer) {
+            ring.push(event_t{now(), message.type_index, message.address.get(), nullptr, trace_point_t::enqueue});
+            return;
+        }
+        if (ring.countdown) {
+            --ring.countdown;
+            return;
+        }
+        ring.countdown = sampling - 1;
+        message.tracer = this;
+        ring.push(event_t{now(), message.type_index, message.address.get(), nullptr, trace_point_t::enqueue});
+#else
+        (void)message;
+#endif
+    }
+
+    /** \brief records the event for the (traced) message */
+    inline void record(trace_point_t point, const message_base_t &message, const void *actor = nullptr) noexcept {
+        get_ring().push(event_t{now(), message.type_index, message.address.get(), actor, point});
+    }
+
+    /** \brief writes the recorded events into the trace file, returns the amount of written events */
+    std::size_t flush() noexcept;
+
+    /** \brief returns the amount of dropped events among all threads */
+    std::uint64_t get_dropped() const noexcept;
+
+  private:
+    using rings_t = std::unordered_map<std::thread::id, std::unique_ptr<details::trace_ring_t>>;
+    using names_t = std::unordered_map<const void *, std::string>;
+
+    static inline std::uint64_t now() noexcept {
+        using namespace std::chrono;
+        return static_cast<std::uint64_t>(duration_cast<nanoseconds>(clock_t::now().time_since_epoch()).count());
+    }
+
+    inline details::trace_ring_t &get_ring() noexcept {
+        auto &cache = details::trace_ring_cache;
+        if (cache.tracer_id != id) {
+            cache.ring = &acquire_ring();
+            cache.tracer_id = id;
+        }
+        return *cache.ring;
+    }
+
+    details::trace_ring_t &acquire_ring() noexcept;
+    void flusher(clock_t::duration interval) noexcept;
+    void write(const details::trace_ring_t &ring, const event_t &event) noexcept;
+    const std::string &get_name(const void *message_type) noexcept;
+
+    const std::uint64_t id;
+    const std::uint32_t sampling;
+    const std::size_t ring_capacity;
+    const std::uint64_t started;
+    mutable std::mutex mutex;
+    rings_t rings;
+    names_t names;
+    std::ofstream out;
+    bool first_event = true;
+    std::mutex flusher_mutex;
+    std::condition_variable flusher_cv;
+    bool stop = false;
+    std::thread flusher_thread;
+};
+
+/** \brief intrusive pointer for tracer */
+using tracer_ptr_t = intrusive_ptr_t<tracer_t>;
+
+} // namespace rotor
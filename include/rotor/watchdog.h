@@ -0,0 +1,236 @@
+#pragma once
+
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "arc.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+
+namespace rotor {
+
+struct watchdog_t;
+
+namespace details {
+
+/** \struct watchdog_slot_t
+ *  \brief per-thread handlers execution marker, observed by the watchdog
+ *
+ * The slot is written by the owning thread only: the sequence is incremented
+ * when a handler is invoked (it becomes odd) and when the handler returns
+ * (it becomes even). The handler details are published before the sequence,
+ * and the watchdog reads them seqlock-way.
+ *
+ */
+struct watchdog_slot_t {
+    /** \brief sequential thread identifier */
+    explicit watchdog_slot_t(std::uint32_t thread_id_) noexcept : thread_id{thread_id_} {}
+
+    /** \brief marks the handler invocation start; returns `false` for nested invocation */
+    inline bool begin(const void *address_, const void *message_type_, const void *handler_type_) noexcept {
+        auto value = sequence.load(std::memory_order_relaxed);
+        if (value & 1) {
+            return false;
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        address.store(address_, std::memory_order_relaxed);
+        message_type.store(message_type_, std::memory_order_relaxed);
+        handler_type.store(handler_type_, std::memory_order_relaxed);
+        sequence.store(value + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** \brief marks the handler invocation end */
+    inline void end() noexcept {
+        sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /** \brief sequential thread identifier */
+    const std::uint32_t thread_id;
+
+    /** \brief the amount of handlers invocations starts and ends */
+    std::atomic<std::uint64_t> sequence{0};
+
+    /** \brief the handler's actor address */
+    std::atomic<const void *> address{nullptr};
+
+    /** \brief the message type, see `message_t::message_type` */
+    std::atomic<const void *> message_type{nullptr};
+
+    /** \brief the handler type, see `handler_base_t::handler_type` */
+    std::atomic<const void *> handler_type{nullptr};
+
+    /** \brief the sequence value, last seen by the watchdog (watchdog-only) */
+    std::uint64_t seen_sequence = 0;
+
+    /** \brief when the watchdog has seen the sequence value first (watchdog-only) */
+    std::chrono::steady_clock::time_point seen_at{};
+};
+
+/** \struct watchdog_slot_cache_t
+ *  \brief per-thread cached slot of the last used watchdog
+ */
+struct watchdog_slot_cache_t {
+    /** \brief the unique watchdog id */
+    std::uint64_t watchdog_id = 0;
+
+    /** \brief the slot of the watchdog for the current thread */
+    watchdog_slot_t *slot = nullptr;
+};
+
+/** \brief per-thread cached slot of the last used watchdog */
+inline thread_local watchdog_slot_cache_t watchdog_slot_cache;
+
+/** \brief the slot of the current thread, where handlers invocations are marked (if any) */
+inline thread_local watchdog_slot_t *watchdog_slot = nullptr;
+
+/** \struct watchdog_scope_t
+ *  \brief marks handlers invocations on the current thread for the watchdog (if any), while it is alive
+ */
+struct watchdog_scope_t {
+    /** \brief starts marking handlers invocations for the watchdog, if it is not `nullptr` */
+    explicit watchdog_scope_t(watchdog_t *watchdog) noexcept;
+
+    /** \brief restores the previous handlers invocations marking on the current thread */
+    inline ~watchdog_scope_t() { watchdog_slot = previous; }
+
+    watchdog_scope_t(const watchdog_scope_t &) = delete;
+    watchdog_scope_t(watchdog_scope_t &&) = delete;
+
+  private:
+    watchdog_slot_t *previous;
+};
+
+} // namespace details
+
+/** \struct slow_handler_t
+ *  \brief the details of the handler, which execution exceeds the watchdog threshold
+ */
+struct slow_handler_t {
+    /** \brief the handler's actor address */
+    const void *address;
+
+    /** \brief the message type, see `message_t::message_type` */
+    const void *message_type;
+
+    /** \brief the handler type, see `handler_base_t::handler_type` */
+    const void *handler_type;
+
+    /** \brief sequential identifier of the thread, which executes the handler */
+    std::uint32_t thread_id;
+
+    /** \brief how long the handler is being executed (at least) */
+    std::chrono::steady_clock::duration duration;
+
+    /** \brief human-readable description, with demangled message and handler types */
+    std::string to_string() const noexcept;
+};
+
+/** \struct watchdog_t
+ *  \brief detects handlers, which execute longer than the threshold
+ *
+ * A handler doing blocking I/O (or long computations) stalls all the actors
+ * of its locality. The watchdog runs a monitor thread, which wakes up each
+ * `check_interval` and inspects whether a handler execution lasts more than the
+ * `threshold` on any of the observed threads. Each such handler invocation is
+ * reported once via the callback, which is invoked on the monitor thread. The
+ * monitor thread is started by `start()`.
+ *
+ * The handlers invocations are not timestamped, they only bump the per-thread
+ * counter, hence the overhead is a few stores per handler invocation, and the
+ * handler duration is detected with the `check_interval` precision.
+ *
+ * The watchdog is installed into the system context (`system_context_t::set_watchdog`)
+ * before the root supervisor creation; it should outlive the supervisors. The
+ * same watchdog can be installed into multiple system contexts.
+ *
+ * If `rotor` is built without `ROTOR_WATCHDOG`, nothing is detected.
+ *
+ */
+struct watchdog_t : arc_base_t<watchdog_t> {
+    /** \brief clock, used for measurements */
+    using clock_t = std::chrono::steady_clock;
+
+    /** \brief slow handler notification callback, invoked on the monitor thread */
+    using callback_t = std::function<void(const slow_handler_t &)>;
+
+    /** \brief constructs the watchdog with the mandatory slow handlers `callback`
+     *
+     * If the `check_interval` is zero, it is the quarter of the `threshold`.
+     *
+     */
+    watchdog_t(const clock_t::duration &threshold, callback_t callback,
+               const clock_t::duration &check_interval = clock_t::duration::zero()) noexcept;
+
+    watchdog_t(const watchdog_t &) = delete;
+    watchdog_t(watchdog_t &&) = delete;
+
+    /** \brief stops the monitor thread (if it was started) */
+    ~watchdog_t();
+
+    /** \brief starts the monitor thread
+     *
+     * The error is returned, if the thread cannot be started.
+     *
+     */
+    std::error_code start() noexcept;
+
+    /** \brief returns the slot of the current thread, where handlers invocations are marked
+     *
+     * Each thread has its own slot in the watchdog, which is reused, i.e. the same
+     * slot is returned even if the thread has used other watchdogs in between.
+     *
+     */
+    inline details::watchdog_slot_t *get_slot() noexcept {
+        auto &cache = details::watchdog_slot_cache;
+        if (cache.watchdog_id != id) {
+            cache.slot = &acquire_slot();
+            cache.watchdog_id = id;
+        }
+        return cache.slot;
+    }
+
+    /** \brief inspects the observed threads, reporting the slow handlers, returns the amount of them
+     *
+     * It is invoked periodically by the monitor thread.
+     *
+     */
+    std::size_t check() noexcept;
+
+    /** \brief returns the total amount of detected slow handlers invocations */
+    inline std::uint64_t get_detected() const noexcept { return detected.load(std::memory_order_relaxed); }
+
+  private:
+    using slots_t = std::unordered_map<std::thread::id, std::unique_ptr<details::watchdog_slot_t>>;
+
+    details::watchdog_slot_t &acquire_slot() noexcept;
+    void monitor() noexcept;
+
+    const std::uint64_t id;
+    const clock_t::duration threshold;
+    const clock_t::duration check_interval;
+    callback_t callback;
+    std::atomic<std::uint64_t> detected{0};
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool stop = false;
+    slots_t slots;
+    std::thread thread;
+};
+
+/** \brief intrusive pointer for watchdog */
+using watchdog_ptr_t = intrusive_ptr_t<watchdog_t>;
+
+} // namespace rotor
@@ -19,8 +19,8 @@ actor_base_t::actor_base_t(actor_config_t &cfg)
       shutdown_timeout{cfg.shutdown_timeout}, state{state_t::NEW} {
     plugins_storage = cfg.plugins_constructor();
     plugins = plugins_storage->get_plugins();
-    for (auto plugin : plugins) {
-        activating_plugins.insert(plugin->identity());
+    for (std::size_t i = 0; i < plugins.size(); ++i) {
+        activating_plugins.insert(i);
     }
 }
 
@@ -38,28 +38,40 @@ void actor_base_t::activate_plugins() noexcept {
     for (auto plugin : plugins) {
         plugin->activate(this);
     }
+    // confirm plugins subscriptions at once (the batch is opened by the lifetime plugin)
+    if (lifetime) {
+        lifetime->commit_subscriptions();
+    }
 }
 
 void actor_base_t::commit_plugin_activation(plugin_base_t &plugin, bool success) noexcept {
     if (success) {
-        activating_plugins.erase(plugin.identity());
+        activating_plugins.erase(get_plugin_index(plugin));
     } else {
         deactivate_plugins();
     }
 }
 
 void actor_base_t::deactivate_plugins() noexcept {
-    for (auto it = plugins.rbegin(); it != plugins.rend(); ++it) {
-        auto &plugin = *--(it.base());
+    // unsubscribe all plugins at once; actor lifetime pointer might be reset during deactivation
+    auto batch = lifetime;
+    if (batch) {
+        batch->begin_unsubscriptions();
+    }
+    for (size_t i = plugins.size(); i > 0; --i) {
+        auto plugin = plugins[i - 1];
         if (plugin->access<actor_base_t>()) { // may be it is already inactive
-            deactivating_plugins.insert(plugin->identity());
+            deactivating_plugins.insert(i - 1);
             plugin->deactivate();
         }
     }
+    if (batch) {
+        batch->commit_unsubscriptions();
+    }
 }
 
 void actor_base_t::commit_plugin_deactivation(plugin_base_t &plugin) noexcept {
-    deactivating_plugins.erase(plugin.identity());
+    deactivating_plugins.erase(get_plugin_index(plugin));
 }
 
 void actor_base_t::init_start() noexcept { state = state_t::INITIALIZING; }
@@ -154,8 +166,13 @@ template <typename Fn, typename Message> static void poll(plugins_t &plugins, Me
 }
 
 void actor_base_t::on_subscription(message::subscription_t &message) noexcept {
+    for (auto &point : message.payload.points) {
+        on_subscription(point);
+    }
+}
+
+void actor_base_t::on_subscription(const subscription_point_t &point) noexcept {
     /*
-    auto& point = message.payload.point;
     std::cout << "actor " << point.handler->actor_ptr.get() << " subscribed to "
               << boost::core::demangle((const char*)point.handler->message_type)
               << " at " << (void*)point.address.get() << "\n";
@@ -163,7 +180,7 @@ void actor_base_t::on_subscription(message::subscription_t &message) noexcept {
     for (size_t i = plugins.size(); i > 0; --i) {
         auto plugin = plugins[i - 1];
         if (plugin->get_reaction() & plugin_base_t::SUBSCRIPTION) {
-            auto consumed = plugin->handle_subscription(message);
+            auto consumed = plugin->handle_subscription(point);
             if (consumed) {
                 plugin->reaction_off(plugin_base_t::SUBSCRIPTION);
             }
@@ -172,25 +189,23 @@ void actor_base_t::on_subscription(message::subscription_t &message) noexcept {
 }
 
 void actor_base_t::on_unsubscription(message::unsubscription_t &message) noexcept {
-    /*
-    auto& point = message.payload.point;
-    std::cout << "actor " << point.handler->actor_ptr.get() << " unsubscribed[i] from "
-              << boost::core::demangle((const char*)point.handler->message_type)
-              << " at " << (void*)point.address.get() << "\n";
-    */
-    poll(plugins, message,
-         [](auto &plugin, auto &message) { return plugin->handle_unsubscription(message.payload.point, false); });
+    auto &payload = message.payload;
+    for (auto &point : payload.points) {
+        on_unsubscription(point, false);
+    }
+    for (auto &point : payload.external_points) {
+        on_unsubscription(point, true);
+    }
 }
 
-void actor_base_t::on_unsubscription_external(message::unsubscription_external_t &message) noexcept {
+void actor_base_t::on_unsubscription(const subscription_point_t &point, bool external) noexcept {
     /*
-    auto& point = message.payload.point;
-    std::cout << "actor " << point.handler->actor_ptr.get() << " unsubscribed[e] from "
+    std::cout << "actor " << point.handler->actor_ptr.get() << " unsubscribed[" << (external ? "e" : "i") << "] from "
               << boost::core::demangle((const char*)point.handler->message_type)
               << " at " << (void*)point.address.get() << "\n";
     */
-    poll(plugins, message,
-         [](auto &plugin, auto &message) { return plugin->handle_unsubscription(message.payload.point, true); });
+    poll(plugins, point,
+         [external](auto &plugin, auto &point) { return plugin->handle_unsubscription(point, external); });
 }
 
 address_ptr_t actor_base_t::create_address() noexcept { return address_maker->create_address(); }
@@ -204,6 +219,14 @@ plugin_base_t *actor_base_t::get_plugin(const void *identity) const noexcept {
     return nullptr;
 }
 
+std::size_t actor_base_t::get_plugin_index(const plugin_base_t &plugin) const noexcept {
+    std::size_t index = 0;
+    while (plugins[index] != &plugin) {
+        ++index;
+    }
+    return index;
+}
+
 void actor_base_t::cancel_timer(request_id_t request_id) noexcept {
     assert(timers_map.find(request_id) != timers_map.end() && "request does exist");
     supervisor->do_cancel_timer(request_id);
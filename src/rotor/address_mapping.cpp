@@ -6,58 +6,27 @@
 
 #include "rotor/address_mapping.h"
 #include "rotor/handler.h"
+#include <algorithm>
 #include <cassert>
 
 using namespace rotor;
 
-void address_mapping_t::set(actor_base_t &actor, const subscription_info_ptr_t &info) noexcept {
-    auto &point_map = actor_map[static_cast<const void *>(&actor)];
+bool address_mapping_t::set(const subscription_info_ptr_t &info) noexcept {
     auto message_type = info->handler->message_type;
-    point_map.try_emplace(message_type, info);
-}
-
-address_ptr_t address_mapping_t::get_mapped_address(actor_base_t &actor, const void *message) noexcept {
-    auto it_points = actor_map.find(static_cast<const void *>(&actor));
-    if (it_points == actor_map.end()) {
-        return address_ptr_t();
-    }
-
-    auto &point_map = it_points->second;
-    auto it_subscription = point_map.find(message);
-    if (it_subscription == point_map.end()) {
-        return address_ptr_t();
-    }
-
-    return it_subscription->second->address;
-}
-
-void address_mapping_t::remove(const subscription_point_t &point) noexcept {
-    auto it_points = actor_map.find(point.owner_ptr);
-    assert(it_points != actor_map.end());
-
-    auto &subs = it_points->second;
-    for (auto it = subs.begin(); it != subs.end();) {
-        auto &info = *it->second;
-        if (info.handler.get() == point.handler.get() && info.address == point.address) {
-            subs.erase(it);
-            break;
-        } else {
-            ++it;
-        }
+    bool first = points.empty();
+    if (!get_mapped_address(message_type)) {
+        points.emplace_back(point_t{message_type, info});
     }
-    if (subs.empty()) {
-        actor_map.erase(it_points);
-    }
-}
-
-/*
-void address_mapping_t::clear(supervisor_t&) noexcept {
-    assert(actor_map.size() == 1);
-    actor_map.clear();
+    return first;
 }
-*/
 
-bool address_mapping_t::has_subscriptions(const actor_base_t &actor) const noexcept {
-    auto it = actor_map.find(static_cast<const void *>(&actor));
-    return it != actor_map.end();
+bool address_mapping_t::remove(const subscription_point_t &point) noexcept {
+    auto predicate = [&point](auto &item) {
+        auto &info = *item.info;
+        return info.handler.get() == point.handler.get() && info.address == point.address;
+    };
+    auto it = std::find_if(points.begin(), points.end(), predicate);
+    assert(it != points.end());
+    points.erase(it);
+    return points.empty();
 }
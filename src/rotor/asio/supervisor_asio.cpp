@@ -27,7 +27,7 @@ inline auto rotor::actor_base_t::access<to::on_timer_trigger, request_id_t, bool
 } // namespace rotor
 
 supervisor_asio_t::supervisor_asio_t(supervisor_config_asio_t &config_)
-    : supervisor_t{config_}, strand{config_.strand} {
+    : supervisor_t{config_}, strand{config_.strand}, single_threaded{config_.single_threaded} {
     if (config_.guard_context) {
         guard = std::make_unique<guard_t>(asio::make_work_guard(strand->context()));
     }
@@ -45,10 +45,10 @@ void supervisor_asio_t::do_start_timer(const pt::time_duration &interval, timer_
 
     intrusive_ptr_t<supervisor_asio_t> self(this);
     request_id_t timer_id = handler.request_id;
-    timer->async_wait([self = std::move(self), timer_id = timer_id](const boost::system::error_code &ec) {
-        auto &strand = self->get_strand();
+    auto on_expiry = [self = std::move(self), timer_id = timer_id](const boost::system::error_code &ec) {
         if (!ec) {
-            asio::defer(strand, [self = std::move(self), timer_id = timer_id]() {
+            auto &sup = *self;
+            sup.defer([self = std::move(self), timer_id = timer_id]() {
                 auto &sup = *self;
                 auto &timers_map = sup.timers_map;
                 auto it = timers_map.find(timer_id);
@@ -60,7 +60,8 @@ void supervisor_asio_t::do_start_timer(const pt::time_duration &interval, timer_
                 }
             });
         }
-    });
+    };
+    timer->async_wait(make_allocated_handler(std::move(on_expiry)));
     timers_map.emplace(timer_id, std::move(timer));
 }
 
@@ -79,9 +80,12 @@ void supervisor_asio_t::do_cancel_timer(request_id_t timer_id) noexcept {
 }
 
 void supervisor_asio_t::enqueue(rotor::message_ptr_t message) noexcept {
+#ifdef ROTOR_ENABLE_METRICS
+    stamp(*message);
+#endif
     auto actor_ptr = supervisor_ptr_t(this);
     // std::cout << "deferring on " << this << ", stopped : " << strand.get_io_context().stopped() << "\n";
-    asio::defer(get_strand(), [actor = std::move(actor_ptr), message = std::move(message)]() mutable {
+    defer([actor = std::move(actor_ptr), message = std::move(message)]() mutable {
         auto &sup = *actor;
         // std::cout << "deferred processing on" << &sup << "\n";
         // sup.enqueue(std::move(message));
@@ -36,6 +36,9 @@ void supervisor_ev_t::async_cb(struct ev_loop *, ev_async *w, int revents) noexc
     sup->on_async();
 }
 
+/* initial amount of preallocated nodes in the inbound queue */
+static constexpr std::size_t inbound_capacity = 64;
+
 static void timer_cb(struct ev_loop *, ev_timer *w, int revents) noexcept {
     assert(revents & EV_TIMER);
     (void)revents;
@@ -54,7 +57,8 @@ static void timer_cb(struct ev_loop *, ev_timer *w, int revents) noexcept {
 }
 
 supervisor_ev_t::supervisor_ev_t(supervisor_config_ev_t &config_)
-    : supervisor_t{config_}, loop{config_.loop}, loop_ownership{config_.loop_ownership}, pending{false} {
+    : supervisor_t{config_}, loop{config_.loop}, loop_ownership{config_.loop_ownership}, pending{false},
+      inbound{inbound_capacity} {
     ev_async_init(&async_watcher, async_cb);
 }
 
@@ -65,50 +69,40 @@ void supervisor_ev_t::do_initialize(system_context_t *ctx) noexcept {
 }
 
 void supervisor_ev_t::enqueue(rotor::message_ptr_t message) noexcept {
-    bool ok{false};
-    try {
-        auto leader = static_cast<supervisor_ev_t *>(locality_leader);
-        auto &inbound = leader->inbound;
-        std::lock_guard<std::mutex> lock(leader->inbound_mutex);
-        if (leader->state < state_t::SHUT_DOWN) {
-            if (!leader->pending) {
-                // async events are "compressed" by EV. Need to do only once
-                intrusive_ptr_add_ref(this);
-            }
-            inbound.emplace_back(std::move(message));
-            ok = true;
-        }
-    } catch (const std::system_error &err) {
-        context->on_error(err.code());
-    }
-
-    if (ok) {
-        ev_async_send(loop, &async_watcher);
+#ifdef ROTOR_ENABLE_METRICS
+    stamp(*message);
+#endif
+    auto leader = static_cast<supervisor_ev_t *>(locality_leader);
+    auto raw = message.detach();
+    if (!leader->inbound.push(raw)) {
+        // the queue node allocation failed: the message is dropped
+        intrusive_ptr_release(raw);
+        context->on_error(std::make_error_code(std::errc::not_enough_memory));
+        return;
     }
+    notify();
 }
 
-void supervisor_ev_t::start() noexcept {
-    bool ok{false};
-    try {
-        auto leader = static_cast<supervisor_ev_t *>(locality_leader);
-        std::lock_guard<std::mutex> lock(leader->inbound_mutex);
-        if (!leader->pending) {
-            intrusive_ptr_add_ref(leader);
-            leader->pending = true;
-        }
-        ok = true;
-    } catch (const std::system_error &err) {
-        context->on_error(err.code());
-    }
+void supervisor_ev_t::start() noexcept { notify(); }
 
-    if (ok) {
-        ev_async_send(loop, &async_watcher);
+void supervisor_ev_t::notify() noexcept {
+    auto leader = static_cast<supervisor_ev_t *>(locality_leader);
+    if (!leader->pending.exchange(true, std::memory_order_acq_rel)) {
+        // async events are "compressed" by EV. Need to do only once
+        intrusive_ptr_add_ref(leader);
+        ev_async_send(leader->loop, &leader->async_watcher);
     }
 }
 
 void supervisor_ev_t::shutdown_finish() noexcept {
     supervisor_t::shutdown_finish();
     ev_async_stop(loop, &async_watcher);
+    // async callback will not be invoked anymore; the flag is left raised, so
+    // the messages enqueued later (from any thread) do not trigger notifications,
+    // they are released in the destructor
+    if (locality_leader == this && pending.exchange(true, std::memory_order_acq_rel)) {
+        intrusive_ptr_release(this);
+    }
     move_inbound_queue();
 }
 
@@ -143,32 +137,24 @@ void supervisor_ev_t::do_cancel_timer(request_id_t timer_id) noexcept {
 }
 
 void supervisor_ev_t::on_async() noexcept {
-    auto leader = static_cast<supervisor_ev_t *>(locality_leader);
-    intrusive_ptr_release(leader);
-    if (move_inbound_queue()) {
-        do_process();
+    // reset the flag before draining, so the messages pushed after the
+    // drain start will trigger a new notification
+    if (pending.exchange(false, std::memory_order_acq_rel)) {
+        intrusive_ptr_release(this);
     }
+    move_inbound_queue();
+    do_process();
 }
 
 supervisor_ev_t::~supervisor_ev_t() {
+    inbound.consume_all([](message_base_t *message) { intrusive_ptr_release(message); });
     if (loop_ownership) {
         ev_loop_destroy(loop);
     }
 }
 
-bool supervisor_ev_t::move_inbound_queue() noexcept {
-    bool ok{false};
+void supervisor_ev_t::move_inbound_queue() noexcept {
     auto leader = static_cast<supervisor_ev_t *>(locality_leader);
-    try {
-        std::lock_guard<std::mutex> lock(leader->inbound_mutex);
-        auto &inbound = leader->inbound;
-        auto &queue = leader->queue;
-        std::move(inbound.begin(), inbound.end(), std::back_inserter(queue));
-        inbound.clear();
-        leader->pending = false;
-        ok = true;
-    } catch (const std::system_error &err) {
-        context->on_error(err.code());
-    }
-    return ok;
+    auto &queue = leader->queue;
+    leader->inbound.consume_all([&queue](message_base_t *message) { queue.emplace_back(message, false); });
 }
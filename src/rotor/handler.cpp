@@ -27,7 +27,9 @@ struct continuation_impl_t : continuation_t {
     continuation_impl_t(handler_intercepted_t &handler_, message_ptr_t &message_) noexcept
         : handler{handler_}, message{message_} {}
 
-    void operator()() const noexcept { handler.call_no_check(message); }
+    void operator()() const noexcept override { handler.call_no_check(message); }
+
+    handler_base_t *get_handler() const noexcept override { return &handler; }
 };
 
 handler_base_t::handler_base_t(actor_base_t &actor, const void *message_type_, const void *handler_type_) noexcept
@@ -0,0 +1,57 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "rotor/histogram.h"
+#include <cmath>
+
+using namespace rotor;
+
+std::uint64_t histogram_t::upper_bound(std::uint32_t bucket) noexcept {
+    if (bucket < sub_buckets) {
+        return bucket;
+    }
+    if (bucket >= buckets - 1) {
+        return ~std::uint64_t(0);
+    }
+    auto shift = bucket / sub_buckets - 1;
+    auto sub = std::uint64_t(bucket % sub_buckets + sub_buckets);
+    return ((sub + 1) << shift) - 1;
+}
+
+std::uint64_t histogram_t::percentile(double percentile) const noexcept {
+    if (!total) {
+        return 0;
+    }
+    auto rank = static_cast<std::uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(total)));
+    if (rank < 1) {
+        rank = 1;
+    }
+    std::uint64_t seen = 0;
+    for (std::uint32_t i = 0; i < buckets; ++i) {
+        seen += counts[i];
+        if (seen >= rank) {
+            auto value = upper_bound(i);
+            return value < max_value ? value : max_value;
+        }
+    }
+    return max_value;
+}
+
+void histogram_t::merge(const histogram_t &other) noexcept {
+    for (std::uint32_t i = 0; i < buckets; ++i) {
+        counts[i] += other.counts[i];
+    }
+    total += other.total;
+    sum += other.sum;
+    if (other.min_value < min_value) {
+        min_value = other.min_value;
+    }
+    if (other.max_value > max_value) {
+        max_value = other.max_value;
+    }
+}
+
+void histogram_t::reset() noexcept { *this = histogram_t{}; }
@@ -19,17 +19,19 @@ struct init_request {};
 struct init_timeout {};
 struct lifetime {};
 struct manager {};
+struct mapped_actors {};
 struct parent {};
 struct policy {};
+struct request_map {};
+struct request_trigger {};
 struct shutdown_timeout {};
 struct state {};
 struct system_context {};
 struct synchronize_start {};
-struct timers_map {};
 } // namespace to
 } // namespace
 
-template <> auto &supervisor_t::access<to::address_mapping>() noexcept { return address_mapping; }
+template <> auto &actor_base_t::access<to::address_mapping>() noexcept { return address_mapping; }
 template <> auto supervisor_t::access<to::discard_request, request_id_t>(request_id_t request_id) noexcept {
     return discard_request(request_id);
 }
@@ -38,13 +40,18 @@ template <> auto &actor_base_t::access<to::init_request>() noexcept { return ini
 template <> auto &actor_base_t::access<to::init_timeout>() noexcept { return init_timeout; }
 template <> auto &actor_base_t::access<to::lifetime>() noexcept { return lifetime; }
 template <> auto &supervisor_t::access<to::manager>() noexcept { return manager; }
+template <> auto &supervisor_t::access<to::mapped_actors>() noexcept { return mapped_actors; }
 template <> auto &supervisor_t::access<to::parent>() noexcept { return parent; }
 template <> auto &supervisor_t::access<to::policy>() noexcept { return policy; }
+template <> auto &supervisor_t::access<to::request_map>() noexcept { return request_map; }
+template <>
+auto supervisor_t::access<to::request_trigger, request_id_t, bool>(request_id_t request_id, bool cancelled) noexcept {
+    return on_request_trigger(request_id, cancelled);
+}
 template <> auto &actor_base_t::access<to::shutdown_timeout>() noexcept { return shutdown_timeout; }
 template <> auto &actor_base_t::access<to::state>() noexcept { return state; }
 template <> auto &supervisor_t::access<to::system_context>() noexcept { return context; }
 template <> auto &supervisor_t::access<to::synchronize_start>() noexcept { return synchronize_start; }
-template <> auto &supervisor_t::access<to::timers_map>() noexcept { return timers_map; }
 
 const void *child_manager_plugin_t::class_identity = static_cast<const void *>(typeid(child_manager_plugin_t).name());
 
@@ -54,6 +61,7 @@ void child_manager_plugin_t::activate(actor_base_t *actor_) noexcept {
     plugin_base_t::activate(actor_);
     static_cast<supervisor_t &>(*actor_).access<to::manager>() = this;
     subscribe(&child_manager_plugin_t::on_create);
+    subscribe(&child_manager_plugin_t::on_create_batch);
     subscribe(&child_manager_plugin_t::on_init);
     subscribe(&child_manager_plugin_t::on_shutdown_trigger);
     subscribe(&child_manager_plugin_t::on_shutdown_confirm);
@@ -62,12 +70,13 @@ void child_manager_plugin_t::activate(actor_base_t *actor_) noexcept {
     reaction_on(reaction_t::SHUTDOWN);
     reaction_on(reaction_t::START);
     actors_map.emplace(actor->get_address(), actor_state_t(actor));
+    ++shutdown_unrequested_count;
     actor->configure(*this);
 }
 
 void child_manager_plugin_t::deactivate() noexcept {
     auto &sup = static_cast<supervisor_t &>(*actor);
-    if (sup.access<to::address_mapping>().empty()) {
+    if (!sup.access<to::mapped_actors>()) {
         if (actors_map.size() == 1)
             remove_child(sup);
         plugin_base_t::deactivate();
@@ -96,6 +105,14 @@ void child_manager_plugin_t::remove_child(const actor_base_t &child) noexcept {
         }
     }
     cancel_init(&child);
+    auto &actor_state = it_actor->second;
+    leave_init_group(actor_state);
+    if (!actor_state.initialized && !actor_state.init_failed && actor_state.actor != actor) {
+        --initializing_count;
+    }
+    if (actor_state.shutdown == request_state_t::NONE) {
+        --shutdown_unrequested_count;
+    }
     actors_map.erase(it_actor);
 
     if (state == state_t::SHUTTING_DOWN && (actors_map.size() <= 1)) {
@@ -120,6 +137,29 @@ void child_manager_plugin_t::create_child(const actor_ptr_t &child) noexcept {
     auto &timeout = child->access<to::init_timeout>();
     sup.send<payload::create_actor_t>(actor->get_address(), child, timeout);
     actors_map.emplace(child->get_address(), actor_state_t(child));
+    ++initializing_count;
+    ++shutdown_unrequested_count;
+    if (static_cast<actor_base_t &>(sup).access<to::state>() == state_t::INITIALIZING) {
+        postponed_init = true;
+    }
+}
+
+void child_manager_plugin_t::create_children(std::vector<actor_ptr_t> &&children) noexcept {
+    auto &sup = static_cast<supervisor_t &>(*actor);
+    auto &context = sup.access<to::system_context>();
+    pt::time_duration timeout;
+    for (auto &child : children) {
+        child->do_initialize(context);
+        // the batch deadline is the longest init timeout among the children
+        auto &child_timeout = child->access<to::init_timeout>();
+        if (child_timeout > timeout) {
+            timeout = child_timeout;
+        }
+        actors_map.emplace(child->get_address(), actor_state_t(child));
+    }
+    initializing_count += children.size();
+    shutdown_unrequested_count += children.size();
+    sup.send<payload::create_actors_t>(actor->get_address(), std::move(children), timeout);
     if (static_cast<actor_base_t &>(sup).access<to::state>() == state_t::INITIALIZING) {
         postponed_init = true;
     }
@@ -133,22 +173,40 @@ void child_manager_plugin_t::on_create(message::create_actor_t &message) noexcep
     sup.template request<payload::initialize_actor_t>(actor_address).send(message.payload.timeout);
 }
 
+void child_manager_plugin_t::on_create_batch(message::create_actors_t &message) noexcept {
+    auto &sup = static_cast<supervisor_t &>(*actor);
+    auto &actors = message.payload.actors;
+    auto timer_id = actor->start_timer(message.payload.timeout, *this, &child_manager_plugin_t::on_init_group_timer);
+    auto &group = init_groups[timer_id];
+    group.requests.reserve(actors.size());
+    group.pending = 0;
+    for (auto &child : actors) {
+        auto &child_address = child->get_address();
+        auto it_actor = actors_map.find(child_address);
+        assert(it_actor != actors_map.end());
+        it_actor->second.init_group = timer_id;
+        ++group.pending;
+        group.requests.emplace_back(sup.template request<payload::initialize_actor_t>(child_address).send_untimed());
+    }
+}
+
 void child_manager_plugin_t::on_init(message::init_response_t &message) noexcept {
     auto &address = message.payload.req->address;
     auto &ec = message.payload.ec;
 
     auto &sup = static_cast<supervisor_t &>(*actor);
-    bool continue_init = false;
-    continue_init = !ec && !has_initializing();
     auto it_actor = actors_map.find(address);
     bool actor_found = it_actor != actors_map.end();
 
+    if (actor_found) {
+        leave_init_group(it_actor->second);
+    }
+
     auto &self_state = actor->access<to::state>();
     if (ec) {
         auto &policy = sup.access<to::policy>();
         auto shutdown_self = self_state == state_t::INITIALIZING && policy == supervisor_policy_t::shutdown_self;
         if (shutdown_self) {
-            continue_init = false;
             auto &init_request = actor->access<to::init_request>();
             if (init_request) {
                 auto ec = make_error_code(error_code_t::failure_escalation);
@@ -159,13 +217,17 @@ void child_manager_plugin_t::on_init(message::init_response_t &message) noexcept
             }
         } else {
             auto source_actor = actor_found ? it_actor->second.actor : this->actor;
+            if (actor_found) {
+                // the failed child does not block initialization of the others
+                mark_init_failed(it_actor->second);
+            }
             source_actor->do_shutdown();
         }
     } else {
         /* the if is needed for the very rare case when supervisor was immediately shut down
            right after creation */
         if (actor_found) {
-            it_actor->second.initialized = true;
+            mark_initialized(it_actor->second);
             bool do_start = (address == actor->get_address()) ? (self_state <= state_t::OPERATIONAL)
                                                               : !sup.access<to::synchronize_start>();
             if (do_start) {
@@ -174,6 +236,8 @@ void child_manager_plugin_t::on_init(message::init_response_t &message) noexcept
             }
         }
     }
+    // the confirmed child is not initializing anymore
+    bool continue_init = !ec && !has_initializing();
     if (continue_init && postponed_init) {
         init_continue();
     }
@@ -199,17 +263,44 @@ void child_manager_plugin_t::cancel_init(const actor_base_t *child) noexcept {
     if (init_request) {
         // options: answer instead of actor (easier, but unexpected message can be seen)
         // or forget the init-request.
-        auto &timer_id = init_request->payload.id;
-        if (sup.access<to::timers_map>().count(timer_id)) {
-            sup.access<to::discard_request, request_id_t>(timer_id);
+        auto &request_id = init_request->payload.id;
+        if (sup.access<to::request_map>().count(request_id)) {
+            sup.access<to::discard_request, request_id_t>(request_id);
         }
     }
 }
 
+void child_manager_plugin_t::leave_init_group(actor_state_t &actor_state) noexcept {
+    auto timer_id = actor_state.init_group;
+    if (timer_id) {
+        actor_state.init_group = 0;
+        auto it = init_groups.find(timer_id);
+        if (it != init_groups.end() && --it->second.pending == 0) {
+            // the group is disposed in the timer callback
+            actor->cancel_timer(timer_id);
+        }
+    }
+}
+
+void child_manager_plugin_t::on_init_group_timer(request_id_t timer_id, bool cancelled) noexcept {
+    auto it = init_groups.find(timer_id);
+    if (it == init_groups.end()) {
+        return;
+    }
+    auto requests = std::move(it->second.requests);
+    init_groups.erase(it);
+    // on expiration the still pending requests are replied with timeout error,
+    // otherwise they are just forgotten
+    auto &sup = static_cast<supervisor_t &>(*actor);
+    for (auto request_id : requests) {
+        sup.access<to::request_trigger, request_id_t, bool>(request_id, cancelled);
+    }
+}
+
 void child_manager_plugin_t::on_shutdown_confirm(message::shutdown_response_t &message) noexcept {
     auto &source_addr = message.payload.req->address;
     auto &actor_state = actors_map.at(source_addr);
-    actor_state.shutdown = request_state_t::CONFIRMED;
+    mark_shutdown(actor_state, request_state_t::CONFIRMED);
     auto &ec = message.payload.ec;
     auto child_actor = actor_state.actor;
     if (ec) {
@@ -218,10 +309,10 @@ void child_manager_plugin_t::on_shutdown_confirm(message::shutdown_response_t &m
     // std::cout << "shutdown confirmed from " << (void*) source_addr.get() << " on " << (void*)actor->address.get() <<
     // "\n";
     auto &sup = static_cast<supervisor_t &>(*actor);
-    auto &address_mapping = sup.access<to::address_mapping>();
-    if (address_mapping.has_subscriptions(*child_actor)) {
+    auto &address_mapping = child_actor->access<to::address_mapping>();
+    if (!address_mapping.empty()) {
         auto action = [&](auto &info) { static_cast<actor_base_t &>(sup).access<to::lifetime>()->unsubscribe(info); };
-        address_mapping.each_subscription(*child_actor, action);
+        address_mapping.each_subscription(action);
     } else {
         remove_child(*child_actor);
     }
@@ -248,7 +339,7 @@ bool child_manager_plugin_t::handle_init(message::init_request_t *) noexcept { r
 bool child_manager_plugin_t::handle_shutdown(message::shutdown_request_t *req) noexcept {
     /* prevent double sending req, i.e. from parent and from self */
     auto &self = actors_map.at(actor->get_address());
-    self.shutdown = request_state_t::CONFIRMED;
+    mark_shutdown(self, request_state_t::CONFIRMED);
     request_shutdown();
 
     /* only own actor left, which will be handled differently */
@@ -265,11 +356,11 @@ void child_manager_plugin_t::request_shutdown(actor_state_t &actor_state) noexce
             if (sup.access<to::parent>()) {
                 // will be routed via shutdown request
                 sup.do_shutdown();
-                actor_state.shutdown = request_state_t::SENT;
+                mark_shutdown(actor_state, request_state_t::SENT);
             } else {
                 // do not do shutdown-request on self
                 if (actor->access<to::state>() != state_t::SHUTTING_DOWN) {
-                    actor_state.shutdown = request_state_t::CONFIRMED;
+                    mark_shutdown(actor_state, request_state_t::CONFIRMED);
                     actor->shutdown_start();
                     request_shutdown();
                     actor->shutdown_continue();
@@ -279,30 +370,58 @@ void child_manager_plugin_t::request_shutdown(actor_state_t &actor_state) noexce
             auto &address = source_actor->get_address();
             auto &timeout = source_actor->access<to::shutdown_timeout>();
             sup.request<payload::shutdown_request_t>(address).send(timeout);
-            actor_state.shutdown = request_state_t::SENT;
+            mark_shutdown(actor_state, request_state_t::SENT);
         }
-        actor_state.shutdown = request_state_t::SENT;
+        mark_shutdown(actor_state, request_state_t::SENT);
     }
 }
 
 void child_manager_plugin_t::request_shutdown() noexcept {
-    for (auto &it : actors_map) {
-        request_shutdown(it.second);
+    for (auto it = actors_map.begin(); shutdown_unrequested_count && it != actors_map.end(); ++it) {
+        request_shutdown(it->second);
+    }
+}
+
+void child_manager_plugin_t::mark_initialized(actor_state_t &actor_state) noexcept {
+    if (!actor_state.initialized) {
+        actor_state.initialized = true;
+        if (!actor_state.init_failed && actor_state.actor != actor) {
+            --initializing_count;
+        }
+    }
+}
+
+void child_manager_plugin_t::mark_init_failed(actor_state_t &actor_state) noexcept {
+    if (!actor_state.initialized && !actor_state.init_failed) {
+        actor_state.init_failed = true;
+        if (actor_state.actor != actor) {
+            --initializing_count;
+        }
     }
 }
 
+void child_manager_plugin_t::mark_shutdown(actor_state_t &actor_state, request_state_t value) noexcept {
+    if (actor_state.shutdown == request_state_t::NONE) {
+        --shutdown_unrequested_count;
+    }
+    actor_state.shutdown = value;
+}
+
 bool child_manager_plugin_t::handle_unsubscription(const subscription_point_t &point, bool external) noexcept {
     if (point.owner_tag == owner_tag_t::SUPERVISOR) {
         auto &sup = static_cast<supervisor_t &>(*actor);
-        auto &address_mapping = sup.access<to::address_mapping>();
-        address_mapping.remove(point);
-        if (!address_mapping.has_subscriptions(*point.owner_ptr)) {
+        auto &mapped_actors = sup.access<to::mapped_actors>();
+        auto it_actor = actors_map.find(point.owner_ptr->get_address());
+        assert(it_actor != actors_map.end());
+        auto &address_mapping = it_actor->second.actor->access<to::address_mapping>();
+        if (address_mapping.remove(point)) {
+            --mapped_actors;
             remove_child(*point.owner_ptr);
         }
         if (actors_map.size() == 0) {
             plugin_base_t::deactivate();
         }
-        if (address_mapping.empty())
+        if (!mapped_actors)
             plugin_base_t::deactivate();
         return false; // handled by lifetime
     } else {
@@ -324,13 +443,4 @@ void child_manager_plugin_t::handle_start(message::start_trigger_t *trigger) noe
     return plugin_base_t::handle_start(trigger);
 }
 
-bool child_manager_plugin_t::has_initializing() const noexcept {
-    auto init_predicate = [&](auto &it) {
-        auto &state = it.second.actor->template access<to::state>();
-        bool still_initializing =
-            (it.first != actor->get_address()) && (state <= state_t::INITIALIZING) && !it.second.initialized;
-        return still_initializing;
-    };
-    bool has_any = std::any_of(actors_map.begin(), actors_map.end(), init_predicate);
-    return has_any;
-}
+bool child_manager_plugin_t::has_initializing() const noexcept { return initializing_count > 0; }
@@ -0,0 +1,107 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "rotor/plugin/coroutine.h"
+#include "rotor/supervisor.h"
+#include <new>
+
+using namespace rotor;
+using namespace rotor::plugin;
+
+namespace {
+namespace to {
+struct state {};
+struct get_plugin {};
+} // namespace to
+} // namespace
+
+template <> auto &actor_base_t::access<to::state>() noexcept { return state; }
+template <> auto actor_base_t::access<to::get_plugin, const void *>(const void *identity) noexcept {
+    return get_plugin(identity);
+}
+
+const void *coroutine_plugin_t::class_identity = static_cast<const void *>(typeid(coroutine_plugin_t).name());
+
+const void *coroutine_plugin_t::identity() const noexcept { return class_identity; }
+
+coroutine_plugin_t::~coroutine_plugin_t() {
+    for (auto &it : frames) {
+        auto frame = it.second.head;
+        while (frame) {
+            auto next = *static_cast<void **>(frame);
+            ::operator delete(frame);
+            frame = next;
+        }
+    }
+}
+
+coroutine_plugin_t *coroutine_plugin_t::get(actor_base_t &actor) noexcept {
+    auto plugin = actor.access<to::get_plugin, const void *>(class_identity);
+    return static_cast<coroutine_plugin_t *>(plugin);
+}
+
+void coroutine_plugin_t::activate(actor_base_t *actor_) noexcept {
+    actor = actor_;
+    reply_address = actor->create_address();
+    reaction_on(reaction_t::SHUTDOWN);
+    return plugin_base_t::activate(actor_);
+}
+
+bool coroutine_plugin_t::handle_shutdown(message::shutdown_request_t *message) noexcept {
+    return waiters.empty() && plugin_base_t::handle_shutdown(message);
+}
+
+void coroutine_plugin_t::suspend(request_id_t request_id, void *frame, message_ptr_t &result,
+                                 resumer_t resumer) noexcept {
+    assert(waiters.count(request_id) == 0 && "request is not awaited yet");
+    waiters.emplace(request_id, waiter_t{frame, &result, resumer});
+}
+
+void coroutine_plugin_t::resume(request_id_t request_id, message_base_t &message) noexcept {
+    auto it = waiters.find(request_id);
+    if (it == waiters.end()) {
+        return;
+    }
+    auto waiter = it->second;
+    waiters.erase(it);
+    *waiter.result = message_ptr_t(&message);
+    waiter.resumer(waiter.frame);
+    if (waiters.empty() && actor->access<to::state>() == state_t::SHUTTING_DOWN) {
+        actor->shutdown_continue();
+    }
+}
+
+void *coroutine_plugin_t::allocate_frame(std::size_t size) noexcept {
+    auto &list = frames[size];
+    if (list.head) {
+        auto frame = list.head;
+        list.head = *static_cast<void **>(frame);
+        --list.count;
+        return frame;
+    }
+    return ::operator new(size, std::nothrow);
+}
+
+void coroutine_plugin_t::deallocate_frame(void *frame, std::size_t size) noexcept {
+    /* the list has been created upon the frame allocation, so no memory is allocated here */
+    auto it = frames.find(size);
+    if (it == frames.end() || it->second.count >= max_cached_frames) {
+        ::operator delete(frame);
+        return;
+    }
+    auto &list = it->second;
+    *static_cast<void **>(frame) = list.head;
+    list.head = frame;
+    ++list.count;
+}
+
+std::size_t coroutine_plugin_t::cached_frames() const noexcept {
+    std::size_t r = 0;
+    for (auto &it : frames) {
+        r += it.second.count;
+    }
+    return r;
+}
@@ -23,6 +23,8 @@ void delivery_plugin_base_t::activate(actor_base_t *actor_) noexcept {
     queue = &sup->locality_leader->queue;
     address = sup->address.get();
     subscription_map = &sup->subscription_map;
+    gauges = &sup->gauges;
+    watchdog = sup->context->get_watchdog().get();
     sup->delivery = this;
 }
 
@@ -35,16 +37,36 @@ void local_delivery_t::delivery(message_ptr_t &message,
         sup.enqueue(std::move(wrapped_message));
     }
     for (auto handler : local_recipients.internal) {
-        handler->call(message);
+        delivery_plugin_base_t::invoke(*handler, message);
     }
 }
 
+std::atomic<std::int32_t> inspected_local_delivery_t::current_threshold{inspected_local_delivery_t::unknown};
+
+void inspected_local_delivery_t::init() noexcept {
+    if (current_threshold.load(std::memory_order_relaxed) != unknown) {
+        return;
+    }
+    auto var = std::getenv("ROTOR_INSPECT_DELIVERY");
+    auto value = var ? static_cast<std::int32_t>(std::atoi(var)) : disabled;
+    auto expected = unknown;
+    current_threshold.compare_exchange_strong(expected, value, std::memory_order_relaxed);
+}
+
 std::string inspected_local_delivery_t::identify(message_base_t *message, std::int32_t threshold) noexcept {
     using boost::core::demangle;
     using T = owner_tag_t;
-    std::string info = demangle((const char *)message->type_index);
-    std::int32_t level = 0;
-    auto dump_point = [](subscription_point_t &p) -> std::string {
+    auto type = message->type_index;
+    bool subscription_related =
+        type == message::subscription_t::message_type || type == message::unsubscription_t::message_type ||
+        type == message::external_subscription_t::message_type ||
+        type == message::commit_unsubscription_t::message_type;
+    std::int32_t level = subscription_related ? 9 : 0;
+    if (level > threshold)
+        return "";
+
+    std::string info = demangle((const char *)type);
+    auto dump_point = [](const subscription_point_t &p) -> std::string {
         std::stringstream out;
         out << " [";
         switch (p.owner_tag) {
@@ -69,41 +91,34 @@ std::string inspected_local_delivery_t::identify(message_base_t *message, std::i
         return out.str();
     };
 
-    if (auto m = dynamic_cast<message::unsubscription_t *>(message); m) {
-        level = 9;
-        info += dump_point(m->payload.point);
-    } else if (auto m = dynamic_cast<message::subscription_t *>(message); m) {
-        level = 9;
-        info += dump_point(m->payload.point);
-    } else if (auto m = dynamic_cast<message::unsubscription_external_t *>(message); m) {
-        level = 9;
-        info += dump_point(m->payload.point);
-    } else if (auto m = dynamic_cast<message::external_subscription_t *>(message); m) {
-        level = 9;
-        info += dump_point(m->payload.point);
-    } else if (auto m = dynamic_cast<message::commit_unsubscription_t *>(message); m) {
-        level = 9;
-        info += dump_point(m->payload.point);
-    } else if (auto m = dynamic_cast<message::deregistration_service_t *>(message); m) {
-        level = 0;
+    if (type == message::subscription_t::message_type) {
+        for (auto &point : static_cast<message::subscription_t *>(message)->payload.points) {
+            info += dump_point(point);
+        }
+    } else if (type == message::unsubscription_t::message_type) {
+        auto m = static_cast<message::unsubscription_t *>(message);
+        for (auto &point : m->payload.points) {
+            info += dump_point(point);
+        }
+        for (auto &point : m->payload.external_points) {
+            info += dump_point(point);
+        }
+    } else if (type == message::external_subscription_t::message_type) {
+        info += dump_point(static_cast<message::external_subscription_t *>(message)->payload.point);
+    } else if (type == message::commit_unsubscription_t::message_type) {
+        for (auto &point : static_cast<message::commit_unsubscription_t *>(message)->payload.points) {
+            info += dump_point(point);
+        }
+    } else if (type == message::deregistration_service_t::message_type) {
         info += ", service = ";
-        info += m->payload.service_name;
+        info += static_cast<message::deregistration_service_t *>(message)->payload.service_name;
     }
-
-    if (level > threshold)
-        return "";
     return info;
 }
 
-void inspected_local_delivery_t::delivery(message_ptr_t &message,
-                                          const subscription_t::joint_handlers_t &local_recipients) noexcept {
-    auto var = std::getenv("ROTOR_INSPECT_DELIVERY");
-    if (var) {
-        int threshold = atoi(var);
-        auto dump = identify(message.get(), threshold);
-        if (dump.size() > 0) {
-            std::cout << ">> " << dump << " for " << message->address.get() << "\n";
-        }
+void inspected_local_delivery_t::dump(message_ptr_t &message, std::int32_t threshold) noexcept {
+    auto dump = identify(message.get(), threshold);
+    if (dump.size() > 0) {
+        std::cout << ">> " << dump << " for " << message->address.get() << "\n";
     }
-    local_delivery_t::delivery(message, local_recipients);
 }
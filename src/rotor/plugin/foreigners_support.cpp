@@ -46,7 +46,7 @@ void foreigners_support_plugin_t::deactivate() noexcept {
 void foreigners_support_plugin_t::on_call(message::handler_call_t &message) noexcept {
     auto &handler = message.payload.handler;
     auto &orig_message = message.payload.orig_message;
-    handler->call(orig_message);
+    delivery_plugin_base_t::invoke(*handler, orig_message);
 }
 
 void foreigners_support_plugin_t::on_subscription_external(message::external_subscription_t &message) noexcept {
@@ -58,9 +58,13 @@ void foreigners_support_plugin_t::on_subscription_external(message::external_sub
 }
 
 void foreigners_support_plugin_t::on_unsubscription(message::commit_unsubscription_t &message) noexcept {
-    auto &sup = static_cast<supervisor_t &>(*actor);
-    auto &point = message.payload.point;
+    for (auto &point : message.payload.points) {
+        commit_unsubscription(point);
+    }
+}
 
+void foreigners_support_plugin_t::commit_unsubscription(const subscription_point_t &point) noexcept {
+    auto &sup = static_cast<supervisor_t &>(*actor);
     auto it = foreign_points.find(point);
     auto &info = *it;
 
@@ -33,9 +33,10 @@ void lifetime_plugin_t::activate(actor_base_t *actor_) noexcept {
     reaction_on(reaction_t::SHUTDOWN);
 
     actor->lifetime = this;
+    // committed by the actor, when all plugins are activated
+    begin_subscriptions();
     // order is important
     subscribe(&lifetime_plugin_t::on_unsubscription);
-    subscribe(&lifetime_plugin_t::on_unsubscription_external);
     subscribe(&lifetime_plugin_t::on_subscription);
 
     return plugin_base_t::activate(actor_);
@@ -59,10 +60,15 @@ void lifetime_plugin_t::unsubscribe(const subscription_info_ptr_t &info_ptr) noe
     auto &dest = handler->actor_ptr->address;
     if (info.access<to::state>() != state_t::UNSUBSCRIBING) {
         info.access<to::state>() = state_t::UNSUBSCRIBING;
-        if (info.access<to::internal_address>()) {
-            actor->send<payload::unsubscription_confirmation_t>(dest, info);
+        auto internal = info.access<to::internal_address>();
+        // only own unsubscriptions are batched
+        if (unsubscriptions_level && handler->actor_ptr.get() == actor) {
+            auto &points = internal ? unsubscriptions.points : unsubscriptions.external_points;
+            points.emplace_back(info);
+        } else if (internal) {
+            actor->send<payload::unsubscription_confirmation_t>(dest, info, subscription_points_t{});
         } else {
-            actor->send<payload::external_unsubscription_t>(dest, info);
+            actor->send<payload::unsubscription_confirmation_t>(dest, subscription_points_t{}, info);
         }
     }
 }
@@ -74,6 +80,7 @@ void lifetime_plugin_t::unsubscribe(const handler_ptr_t &h, const address_ptr_t
 }
 
 void lifetime_plugin_t::unsubscribe() noexcept {
+    begin_unsubscriptions();
     auto rit = points.rbegin();
     while (rit != points.rend()) {
         auto &info = *rit;
@@ -85,6 +92,7 @@ void lifetime_plugin_t::unsubscribe() noexcept {
             rit = std::reverse_iterator(it);
         }
     }
+    commit_unsubscriptions();
     /* wait only self to be deactivated */
     if (points.empty() && ready_to_shutdown()) {
         plugin_base_t::deactivate();
@@ -94,10 +102,69 @@ void lifetime_plugin_t::unsubscribe() noexcept {
 
 void lifetime_plugin_t::on_subscription(message::subscription_t &msg) noexcept { actor->on_subscription(msg); }
 
-void lifetime_plugin_t::on_unsubscription(message::unsubscription_t &msg) noexcept { actor->on_unsubscription(msg); }
+void lifetime_plugin_t::begin_subscriptions() noexcept { ++batch_level; }
 
-void lifetime_plugin_t::on_unsubscription_external(message::unsubscription_external_t &msg) noexcept {
-    actor->on_unsubscription_external(msg);
+void lifetime_plugin_t::commit_subscriptions() noexcept {
+    assert(batch_level && "subscriptions batch was started");
+    if (--batch_level == 0 && !batch.empty()) {
+        actor->send<payload::subscription_confirmation_t>(actor->get_address(), std::move(batch));
+        batch.clear();
+    }
+}
+
+bool lifetime_plugin_t::batch_subscription(const subscription_point_t &point) noexcept {
+    if (!batch_level) {
+        return false;
+    }
+    batch.emplace_back(point);
+    return true;
+}
+
+void lifetime_plugin_t::begin_unsubscriptions() noexcept { ++unsubscriptions_level; }
+
+void lifetime_plugin_t::commit_unsubscriptions() noexcept {
+    assert(unsubscriptions_level && "unsubscriptions batch was started");
+    if (--unsubscriptions_level == 0) {
+        auto &batch = unsubscriptions;
+        if (!batch.points.empty() || !batch.external_points.empty()) {
+            actor->send<payload::unsubscription_confirmation_t>(actor->get_address(), std::move(batch));
+            batch.points.clear();
+            batch.external_points.clear();
+        }
+    }
+}
+
+void lifetime_plugin_t::commit_external(const subscription_point_t &point) noexcept {
+    if (external_commits) {
+        external_commits->emplace_back(point);
+    } else {
+        auto &sup_addr = static_cast<actor_base_t &>(point.address->supervisor).get_address();
+        actor->send<payload::commit_unsubscription_t>(sup_addr, point);
+    }
+}
+
+void lifetime_plugin_t::on_unsubscription(message::unsubscription_t &msg) noexcept {
+    if (msg.payload.external_points.size() < 2) {
+        // nothing to group, the external unsubscription (if any) is committed as usual
+        actor->on_unsubscription(msg);
+        return;
+    }
+
+    auto act = actor; /* backup, as the plugin might be deactivated */
+    subscription_points_t commits;
+    external_commits = &commits;
+    act->on_unsubscription(msg);
+    external_commits = nullptr;
+
+    // a commit per foreign supervisor
+    std::unordered_map<const supervisor_t *, subscription_points_t> groups;
+    for (auto &point : commits) {
+        groups[&point.address->supervisor].emplace_back(point);
+    }
+    for (auto &it : groups) {
+        auto &sup_addr = static_cast<const actor_base_t &>(*it.first).get_address();
+        act->send<payload::commit_unsubscription_t>(sup_addr, std::move(it.second));
+    }
 }
 
 void lifetime_plugin_t::initate_subscription(const subscription_info_ptr_t &info) noexcept {
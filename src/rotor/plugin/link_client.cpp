@@ -35,16 +35,19 @@ const void *link_client_plugin_t::identity() const noexcept { return class_ident
 
 void link_client_plugin_t::activate(actor_base_t *actor_) noexcept {
     plugin_base_t::activate(actor_);
-    subscribe(&link_client_plugin_t::on_link_response);
-    subscribe(&link_client_plugin_t::on_unlink_request);
-
+    // the subscriptions are made upon the first link
     reaction_on(reaction_t::INIT);
-    reaction_on(reaction_t::SHUTDOWN);
 }
 
 void link_client_plugin_t::link(const address_ptr_t &address, bool operational_only,
                                 const link_callback_t &callback) noexcept {
     assert(servers_map.count(address) == 0);
+    if (!subscribed) {
+        subscribed = true;
+        subscribe(&link_client_plugin_t::on_link_response);
+        subscribe(&link_client_plugin_t::on_unlink_request);
+        reaction_on(reaction_t::SHUTDOWN);
+    }
     reaction_on(reaction_t::INIT);
     auto &timeout = actor->access<to::init_timeout>();
     auto request_id = actor->request<payload::link_request_t>(address, operational_only).send(timeout);
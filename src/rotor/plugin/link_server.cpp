@@ -32,9 +32,12 @@ void link_server_plugin_t::activate(actor_base_t *actor_) noexcept {
     plugin_base_t::activate(actor_);
     actor->access<to::link_server>() = this;
     subscribe(&link_server_plugin_t::on_link_request);
+}
+
+void link_server_plugin_t::on_first_client() noexcept {
+    has_linked = true;
     subscribe(&link_server_plugin_t::on_unlink_response);
     subscribe(&link_server_plugin_t::on_unlink_notify);
-
     reaction_on(reaction_t::SHUTDOWN);
 }
 
@@ -53,6 +56,10 @@ void link_server_plugin_t::on_link_request(message::link_request_t &message) noe
         return;
     }
 
+    if (!has_linked) {
+        on_first_client();
+    }
+
     bool operational_only = message.payload.request_payload.operational_only;
     if (operational_only && state < state_t::OPERATIONAL) {
         linked_clients.emplace(client_addr, link_info_t(link_state_t::PENDING, link_request_ptr_t{&message}));
@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "rotor/plugin/metrics.h"
+#include "rotor/supervisor.h"
+
+using namespace rotor;
+using namespace rotor::plugin;
+
+namespace {
+namespace to {
+struct get_plugin {};
+struct observed_actors {};
+} // namespace to
+} // namespace
+
+template <> auto actor_base_t::access<to::get_plugin, const void *>(const void *identity) noexcept {
+    return get_plugin(identity);
+}
+template <> auto &supervisor_t::access<to::observed_actors>() noexcept { return observed_actors; }
+
+const void *metrics_plugin_t::class_identity = static_cast<const void *>(typeid(metrics_plugin_t).name());
+
+const void *metrics_plugin_t::identity() const noexcept { return class_identity; }
+
+metrics_plugin_t *metrics_plugin_t::get(actor_base_t &actor) noexcept {
+    auto plugin = actor.access<to::get_plugin, const void *>(class_identity);
+    return static_cast<metrics_plugin_t *>(plugin);
+}
+
+void metrics_plugin_t::activate(actor_base_t *actor_) noexcept {
+    actor = actor_;
+    actor->metrics = this;
+    actor->get_supervisor().access<to::observed_actors>().fetch_add(1, std::memory_order_relaxed);
+    return plugin_base_t::activate(actor_);
+}
+
+void metrics_plugin_t::deactivate() noexcept {
+    actor->get_supervisor().access<to::observed_actors>().fetch_sub(1, std::memory_order_relaxed);
+    actor->metrics = nullptr;
+    return plugin_base_t::deactivate();
+}
+
+void metrics_plugin_t::call(handler_base_t &handler, message_ptr_t &message) noexcept {
+    auto started = clock_t::now();
+    handler.call(message);
+    record(handler.message_type, started, clock_t::now(), *message);
+}
+
+void metrics_plugin_t::record(const void *message_type, const clock_t::time_point &started,
+                              const clock_t::time_point &finished, const message_base_t &message) noexcept {
+    using namespace std::chrono;
+    auto elapsed = static_cast<std::uint64_t>(duration_cast<nanoseconds>(finished - started).count());
+    ++messages;
+    handlers_time += elapsed;
+
+    if (message_type != last_type) {
+        last_metrics = &message_metrics[message_type];
+        last_type = message_type;
+    }
+    auto &metrics = *last_metrics;
+    ++metrics.count;
+    metrics.handler_time.record(elapsed);
+#ifdef ROTOR_ENABLE_METRICS
+    if (message.enqueued_at != clock_t::time_point{} && message.enqueued_at <= started) {
+        auto waited = duration_cast<nanoseconds>(started - message.enqueued_at).count();
+        metrics.queue_time.record(static_cast<std::uint64_t>(waited));
+    }
+#else
+    (void)message;
+#endif
+}
+
+void metrics_plugin_t::reset() noexcept {
+    messages = 0;
+    handlers_time = 0;
+    message_metrics.clear();
+    last_metrics = nullptr;
+    last_type = nullptr;
+}
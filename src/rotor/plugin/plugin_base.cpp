@@ -39,9 +39,11 @@ void plugin_base_t::deactivate() noexcept {
             assert(lifetime);
 
             auto &subs = own_subscriptions;
+            lifetime->begin_unsubscriptions();
             for (auto rit = subs.rbegin(); rit != subs.rend(); ++rit) {
                 lifetime->unsubscribe(*rit);
             }
+            lifetime->commit_unsubscriptions();
         }
     }
 }
@@ -77,15 +79,16 @@ bool plugin_base_t::forget_subscription(const subscription_point_t &point) noexc
     return false;
 }
 
-bool plugin_base_t::handle_subscription(message::subscription_t &) noexcept { return false; }
+bool plugin_base_t::handle_subscription(const subscription_point_t &) noexcept { return false; }
 
 bool plugin_base_t::handle_unsubscription(const subscription_point_t &point, bool external) noexcept {
     if (external) {
         auto act = actor; /* backup */
+        auto lifetime = act->access<to::lifetime>(); /* might be reset upon forgetting */
+        assert(lifetime);
         auto ok = forget_subscription(point);
         assert(ok && "unsubscription handled");
-        auto &sup_addr = static_cast<actor_base_t &>(point.address->supervisor).get_address();
-        act->send<payload::commit_unsubscription_t>(sup_addr, point);
+        lifetime->commit_external(point);
         return ok;
     }
     return forget_subscription(point);
@@ -30,12 +30,8 @@ const void *registry_plugin_t::identity() const noexcept { return class_identity
 
 void registry_plugin_t::activate(actor_base_t *actor_) noexcept {
     plugin_base_t::activate(actor_);
-    subscribe(&registry_plugin_t::on_registration);
-    subscribe(&registry_plugin_t::on_discovery);
-    subscribe(&registry_plugin_t::on_future);
-
+    // the subscriptions are made upon the first registration or discovery
     reaction_on(reaction_t::INIT);
-    reaction_on(reaction_t::SHUTDOWN);
 }
 
 void registry_plugin_t::register_name(const std::string &name, const address_ptr_t &address) noexcept {
@@ -95,6 +91,11 @@ void registry_plugin_t::continue_init(const std::error_code &ec) noexcept {
 
 void registry_plugin_t::link_registry() noexcept {
     plugin_state = plugin_state | LINKING;
+    subscribe(&registry_plugin_t::on_registration);
+    subscribe(&registry_plugin_t::on_discovery);
+    subscribe(&registry_plugin_t::on_future);
+    reaction_on(reaction_t::SHUTDOWN);
+
     auto plugin = actor->access<to::get_plugin>(link_client_plugin_t::class_identity);
     auto p = static_cast<link_client_plugin_t *>(plugin);
     auto &registry_addr = actor->get_supervisor().get_registry_address();
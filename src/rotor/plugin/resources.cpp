@@ -28,8 +28,8 @@ const void *resources_plugin_t::identity() const noexcept { return class_identit
 void resources_plugin_t::activate(actor_base_t *actor_) noexcept {
     actor = actor_;
 
+    // shutdown reaction is needed only after the first resource acquisition
     reaction_on(reaction_t::INIT);
-    reaction_on(reaction_t::SHUTDOWN);
 
     actor->access<to::resources>() = this;
     actor->configure(*this);
@@ -57,9 +57,8 @@ void resources_plugin_t::acquire(resource_id_t id) noexcept {
     auto state = actor->access<to::state>();
     if (state == state_t::INITIALIZING) {
         reaction_on(reaction_t::INIT);
-    } else if (state >= state_t::OPERATIONAL) {
-        reaction_on(reaction_t::SHUTDOWN);
     }
+    reaction_on(reaction_t::SHUTDOWN);
 }
 
 bool resources_plugin_t::release(resource_id_t id) noexcept {
@@ -14,11 +14,13 @@ namespace {
 namespace to {
 struct state {};
 struct plugins {};
+struct lifetime {};
 } // namespace to
 } // namespace
 
 template <> auto &actor_base_t::access<to::state>() noexcept { return state; }
 template <> auto &actor_base_t::access<to::plugins>() noexcept { return plugins; }
+template <> auto &actor_base_t::access<to::lifetime>() noexcept { return lifetime; }
 
 const void *starter_plugin_t::class_identity = static_cast<const void *>(typeid(starter_plugin_t).name());
 
@@ -39,23 +41,23 @@ void starter_plugin_t::deactivate() noexcept {
     return plugin_base_t::deactivate();
 }
 
-bool starter_plugin_t::handle_subscription(message::subscription_t &message) noexcept {
-    auto &point = message.payload.point;
-    auto it = std::find_if(tracked.begin(), tracked.end(), [&](auto info) { return *info == point; });
-    if (it != tracked.end()) {
-        tracked.erase(it);
-    }
+bool starter_plugin_t::handle_subscription(const subscription_point_t &point) noexcept {
+    tracked.erase(point);
     if (configured && tracked.empty()) {
         actor->init_continue();
         return true;
     }
-    return plugin_base_t::handle_subscription(message);
+    return plugin_base_t::handle_subscription(point);
 }
 
 bool starter_plugin_t::handle_init(message::init_request_t *message) noexcept {
     if (!configured) {
         configured = true;
+        // all actor subscriptions are confirmed by a single message
+        auto lifetime = actor->access<to::lifetime>();
+        lifetime->begin_subscriptions();
         actor->configure(*this);
+        lifetime->commit_subscriptions();
         if (tracked.empty()) {
             reaction_off(reaction_t::INIT);
             reaction_off(reaction_t::SUBSCRIPTION);
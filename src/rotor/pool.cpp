@@ -0,0 +1,125 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "rotor/pool.h"
+#include <cstdint>
+#include <new>
+
+using namespace rotor::details;
+
+namespace {
+
+/* free (recycled) memory block */
+struct block_t {
+    block_t *next;
+};
+
+/* thread-local free lists of recycled memory blocks, grouped by size classes;
+   it is trivially destructible, so it is safe to touch it at any point of thread lifetime */
+struct cache_t {
+    /* size class step, in bytes */
+    static constexpr std::size_t granularity = 16;
+
+    /* number of size classes, i.e. the largest recycled block is 1024 bytes */
+    static constexpr std::size_t classes = 64;
+
+    /* max number of recycled blocks per size class */
+    static constexpr std::uint32_t max_cached = 1024;
+
+    block_t *heads[classes];
+    std::uint32_t counts[classes];
+    std::uint32_t scopes;
+    bool released;
+};
+
+thread_local cache_t cache{};
+
+/* releases recycled memory blocks at thread exit */
+struct cache_guard_t {
+    ~cache_guard_t() {
+        for (std::size_t i = 0; i < cache_t::classes; ++i) {
+            auto block = cache.heads[i];
+            while (block) {
+                auto next = block->next;
+                ::operator delete(block);
+                block = next;
+            }
+            cache.heads[i] = nullptr;
+            cache.counts[i] = 0;
+        }
+        cache.released = true;
+    }
+};
+
+thread_local cache_guard_t cache_guard;
+
+inline std::size_t size_class(std::size_t size) noexcept {
+    return (size + cache_t::granularity - 1) / cache_t::granularity;
+}
+
+} // namespace
+
+void *rotor::details::pool_allocate(std::size_t size) {
+    auto index = size_class(size);
+    if (index && index <= cache_t::classes) {
+        --index;
+        auto block = cache.heads[index];
+        if (block) {
+            cache.heads[index] = block->next;
+            --cache.counts[index];
+            return block;
+        }
+        return ::operator new((index + 1) * cache_t::granularity);
+    }
+    return ::operator new(size);
+}
+
+void rotor::details::pool_recycle(void *ptr, std::size_t size) noexcept {
+    auto index = size_class(size);
+    if (index && index <= cache_t::classes && !cache.released) {
+        --index;
+        if (cache.counts[index] < cache_t::max_cached) {
+            if (!cache.counts[index]) {
+                // make sure the blocks will be released at thread exit
+                (void)&cache_guard;
+            }
+            auto block = static_cast<block_t *>(ptr);
+            block->next = cache.heads[index];
+            cache.heads[index] = block;
+            ++cache.counts[index];
+            return;
+        }
+    }
+    ::operator delete(ptr);
+}
+
+void rotor::details::pool_deallocate(void *ptr, std::size_t size) noexcept {
+    if (cache.scopes) {
+        pool_recycle(ptr, size);
+    } else {
+        ::operator delete(ptr);
+    }
+}
+
+std::size_t rotor::details::pool_cached() noexcept {
+    std::size_t r = 0;
+    for (std::size_t i = 0; i < cache_t::classes; ++i) {
+        r += cache.counts[i];
+    }
+    return r;
+}
+
+pool_scope_t::pool_scope_t(bool enabled_) noexcept : enabled{enabled_} {
+    if (enabled) {
+        ++cache.scopes;
+    }
+}
+
+pool_scope_t::~pool_scope_t() {
+    if (enabled) {
+        --cache.scopes;
+    }
+}
@@ -18,6 +18,7 @@ template <> auto &supervisor_t::access<to::subscription_map>() noexcept { return
 namespace tags {
 
 const void *io = &io;
+const void *io_offload = &io_offload;
 
 }
 
@@ -25,17 +26,77 @@ bool subscription_point_t::operator==(const subscription_point_t &other) const n
     return address == other.address && (*handler == *other.handler);
 }
 
+void subscription_points_t::emplace_back(const subscription_point_t &point) noexcept {
+    if (spilled.empty()) {
+        if (!single) {
+            single.emplace(point);
+            return;
+        }
+        spilled.emplace_back(std::move(*single));
+        single.reset();
+    }
+    spilled.emplace_back(point);
+}
+
+void subscription_points_t::clear() noexcept {
+    single.reset();
+    spilled.clear();
+}
+
+void subscription_container_t::emplace_back(const subscription_info_ptr_t &info) noexcept {
+    auto it = items.emplace(items.end(), info);
+    if (!index.empty()) {
+        index.emplace(info.get(), indexed_t{it, next_seq++});
+    } else if (items.size() > index_threshold) {
+        for (auto i = items.begin(); i != items.end(); ++i) {
+            index.emplace(i->get(), indexed_t{i, next_seq++});
+        }
+    }
+}
+
+subscription_container_t::iterator subscription_container_t::erase(iterator it) noexcept {
+    if (!index.empty()) {
+        auto range = index.equal_range(it->get());
+        for (auto i = range.first; i != range.second; ++i) {
+            if (i->second.it == it) {
+                index.erase(i);
+                break;
+            }
+        }
+    }
+    return items.erase(it);
+}
+
 subscription_container_t::iterator subscription_container_t::find(const subscription_point_t &point) noexcept {
+    if (!index.empty()) {
+        auto range = index.equal_range(&point);
+        if (range.first == range.second) {
+            return items.end();
+        }
+        auto last = range.first;
+        for (auto i = std::next(range.first); i != range.second; ++i) {
+            if (i->second.seq > last->second.seq) {
+                last = i;
+            }
+        }
+        return last->second.it;
+    }
     auto predicate = [&point](auto &info) {
         return *info->handler == *point.handler && info->address == point.address;
     };
-    auto rit = std::find_if(rbegin(), rend(), predicate);
-    if (rit == rend()) {
-        return end();
+    auto rit = std::find_if(items.rbegin(), items.rend(), predicate);
+    if (rit == items.rend()) {
+        return items.end();
     }
     return --rit.base();
 }
 
+void subscription_container_t::clear() noexcept {
+    index.clear();
+    items.clear();
+    next_seq = 0;
+}
+
 void subscription_info_t::tag(const void *t) noexcept {
     auto new_handler = handler->upgrade(t);
     auto &sup = handler->actor_ptr->get_supervisor();
@@ -44,3 +105,7 @@ void subscription_info_t::tag(const void *t) noexcept {
 }
 
 } // namespace rotor
+
+size_t std::hash<rotor::subscription_point_t>::operator()(const rotor::subscription_point_t &point) const noexcept {
+    return point.handler->precalc_hash ^ std::hash<rotor::address_ptr_t>()(point.address);
+}
@@ -22,21 +22,18 @@ template <> auto &subscription_info_t::access<to::internal_handler>() noexcept {
 
 supervisor_t::supervisor_t(supervisor_config_t &config)
     : actor_base_t(config), last_req_id{0}, subscription_map(*this), parent{config.supervisor}, manager{nullptr},
-      create_registry(config.create_registry), synchronize_start(config.synchronize_start),
+      create_registry(config.create_registry), synchronize_start(config.synchronize_start), pool(config.pool),
+      collect_request_stats(config.request_stats),
+      collect_queueing_stats(config.queueing_stats || (parent && parent->collect_queueing_stats)),
       registry_address(config.registry_address), policy{config.policy} {
+    root = parent ? parent->root : this;
     if (!supervisor) {
         supervisor = this;
     }
     supervisor = this;
 }
 
-address_ptr_t supervisor_t::make_address() noexcept {
-    auto root_sup = this;
-    while (root_sup->parent) {
-        root_sup = root_sup->parent;
-    }
-    return instantiate_address(root_sup);
-}
+address_ptr_t supervisor_t::make_address() noexcept { return instantiate_address(root); }
 
 address_ptr_t supervisor_t::instantiate_address(const void *locality) noexcept {
     return new address_t{*this, locality};
@@ -71,7 +68,14 @@ subscription_info_ptr_t supervisor_t::subscribe(const handler_ptr_t &handler, co
     auto sub_info = subscription_map.materialize(point);
 
     if (sub_info->access<to::internal_address>()) {
-        send<payload::subscription_confirmation_t>(handler->actor_ptr->address, point);
+        auto &dest = handler->actor_ptr;
+        // the batch is accessible only from the actor's own thread; an actor
+        // without lifetime plugin (or already shut down) gets the confirmation as usual
+        auto lifetime = dest->lifetime;
+        auto batched = sub_info->access<to::internal_handler>() && lifetime && lifetime->batch_subscription(point);
+        if (!batched) {
+            send<payload::subscription_confirmation_t>(dest->address, point);
+        }
     } else {
         send<payload::external_subscription_t>(addr->supervisor.address, point);
     }
@@ -100,8 +104,13 @@ void supervisor_t::intercept(message_ptr_t &, const void *, const continuation_t
 void supervisor_t::on_request_trigger(request_id_t timer_id, bool cancelled) noexcept {
     auto it = request_map.find(timer_id);
     if (it != request_map.end()) {
+        auto &request_curry = it->second;
+#ifdef ROTOR_ENABLE_METRICS
+        if (request_curry.stats) {
+            untrack_request(request_curry, cancelled ? &request_stats_t::cancelled : &request_stats_t::timed_out);
+        }
+#endif
         if (!cancelled) {
-            auto &request_curry = it->second;
             message_ptr_t &request = request_curry.request_message;
             auto ec = make_error_code(error_code_t::request_timeout);
             auto timeout_message = request_curry.fn(request_curry.origin, *request, std::move(ec));
@@ -111,13 +120,80 @@ void supervisor_t::on_request_trigger(request_id_t timer_id, bool cancelled) noe
     }
 }
 
-void supervisor_t::discard_request(request_id_t request_id) noexcept {
+void supervisor_t::discard_request(request_id_t request_id, bool responded) noexcept {
     assert(request_map.find(request_id) != request_map.end());
-    cancel_timer(request_id);
+#ifdef ROTOR_ENABLE_METRICS
+    auto &request_curry = request_map.find(request_id)->second;
+    if (request_curry.stats) {
+        untrack_request(request_curry, responded ? &request_stats_t::responded : &request_stats_t::cancelled);
+    }
+#else
+    (void)responded;
+#endif
+    // untimed requests (i.e. guarded by a group timer) have no own timer
+    if (timers_map.count(request_id)) {
+        cancel_timer(request_id);
+    }
     request_map.erase(request_id);
 }
 
+#ifdef ROTOR_ENABLE_METRICS
+void supervisor_t::track_request(request_curry_t &curry) noexcept {
+    auto &stats = request_stats[curry.request_message->type_index];
+    ++stats.sent;
+    stats.in_flight_depth.record(++stats.in_flight);
+    curry.stats = &stats;
+    curry.sent_at = std::chrono::steady_clock::now();
+}
+
+void supervisor_t::untrack_request(request_curry_t &curry, std::uint64_t request_stats_t::*outcome) noexcept {
+    using namespace std::chrono;
+    auto &stats = *curry.stats;
+    ++(stats.*outcome);
+    --stats.in_flight;
+    if (outcome == &request_stats_t::responded) {
+        auto round_trip = duration_cast<nanoseconds>(steady_clock::now() - curry.sent_at).count();
+        stats.round_trip.record(static_cast<std::uint64_t>(round_trip));
+    }
+    curry.stats = nullptr;
+}
+#endif
+
+#ifdef ROTOR_ENABLE_METRICS
+void supervisor_t::record_queueing(message_base_t &message) noexcept {
+    using namespace std::chrono;
+    auto now = steady_clock::now();
+    if (message.enqueued_at <= now) {
+        auto delay = duration_cast<nanoseconds>(now - message.enqueued_at).count();
+        queueing_stats.record(message.type_index, static_cast<std::uint64_t>(delay));
+    }
+}
+#endif
+
+void supervisor_t::reset_request_stats() noexcept {
+    for (auto &it : request_stats) {
+        auto in_flight = it.second.in_flight;
+        it.second = request_stats_t{};
+        it.second.in_flight = in_flight;
+    }
+}
+
 void supervisor_t::shutdown_finish() noexcept {
     actor_base_t::shutdown_finish();
     assert(request_map.size() == 0);
 }
+
+supervisor_stats_t details::supervisor_gauges_t::snapshot() const noexcept {
+    auto load = [](const gauge_t &gauge) { return gauge.load(std::memory_order_relaxed); };
+    supervisor_stats_t r;
+    r.process_calls = load(process_calls);
+    r.processed = load(processed);
+    r.max_processed = load(max_processed);
+    r.process_time = load(process_time);
+    r.queue_high_water = load(queue_high_water);
+    r.cross_enqueued = load(cross_enqueued);
+    r.inbound_depth = load(inbound_depth);
+    r.inbound_high_water = load(inbound_high_water);
+    r.parked_time = load(parked_time);
+    return r;
+}
@@ -14,6 +14,9 @@ void supervisor_thread_t::shutdown() noexcept {
 }
 
 void supervisor_thread_t::enqueue(message_ptr_t message) noexcept {
+#ifdef ROTOR_ENABLE_METRICS
+    stamp(*message);
+#endif
     auto ctx = static_cast<system_context_thread_t *>(context);
     std::lock_guard<std::mutex> lock(ctx->mutex);
     ctx->inbound.emplace_back(std::move(message));
@@ -23,7 +26,13 @@ void supervisor_thread_t::enqueue(message_ptr_t message) noexcept {
 void supervisor_thread_t::intercept(message_ptr_t &message, const void *tag,
                                     const continuation_t &continuation) noexcept {
     auto ctx = static_cast<system_context_thread_t *>(context);
-    if (tag == rotor::tags::io) {
+    if (tag == rotor::tags::io || tag == rotor::tags::io_offload) {
+        if (tag == rotor::tags::io_offload) {
+            auto handler = continuation.get_handler();
+            if (handler && ctx->offload(message, *handler)) {
+                return;
+            }
+        }
         ctx->intercepting = true;
         ctx->check();
         supervisor_t::intercept(message, tag, continuation);
@@ -1,5 +1,6 @@
 #include "rotor/thread/system_context_thread.h"
 #include "rotor/supervisor.h"
+#include "rotor/plugin/resources.h"
 #include <chrono>
 
 namespace rotor {
@@ -10,18 +11,47 @@ namespace to {
 struct state {};
 struct queue {};
 struct on_timer_trigger {};
+struct resources {};
+#ifdef ROTOR_ENABLE_METRICS
+struct gauges {};
+#endif
 } // namespace to
 } // namespace
 
 template <> auto &supervisor_t::access<to::state>() noexcept { return state; }
 template <> auto &supervisor_t::access<to::queue>() noexcept { return queue; }
+#ifdef ROTOR_ENABLE_METRICS
+template <> auto &supervisor_t::access<to::gauges>() noexcept { return gauges; }
+#endif
+template <> auto &actor_base_t::access<to::resources>() noexcept { return resources; }
 template <>
 inline auto rotor::actor_base_t::access<to::on_timer_trigger, request_id_t, bool>(request_id_t request_id,
                                                                                   bool cancelled) noexcept {
     on_timer_trigger(request_id, cancelled);
 }
 
-system_context_thread_t::system_context_thread_t() noexcept { update_time(); }
+system_context_thread_t::system_context_thread_t(std::size_t io_threads_, std::size_t io_jobs_limit_) noexcept
+    : io_jobs_limit{io_jobs_limit_} {
+    update_time();
+#ifdef ROTOR_REFCOUNT_THREADUNSAFE
+    /* handlers and messages are refcounted from the pool threads */
+    io_threads_ = 0;
+#endif
+    for (std::size_t i = 0; i < io_threads_; ++i) {
+        io_threads.emplace_back([this]() { io_loop(); });
+    }
+}
+
+system_context_thread_t::~system_context_thread_t() {
+    do {
+        std::lock_guard<std::mutex> lock(io_mutex);
+        io_stop = true;
+    } while (0);
+    io_cv.notify_all();
+    for (auto &thread : io_threads) {
+        thread.join();
+    }
+}
 
 void system_context_thread_t::run() noexcept {
     using std::chrono::duration_cast;
@@ -30,21 +60,28 @@ void system_context_thread_t::run() noexcept {
     while (condition()) {
         root_sup.do_process();
         if (condition()) {
-            auto predicate = [&]() -> bool { return !inbound.empty(); };
+            auto predicate = [&]() -> bool { return !inbound.empty() || !io_completed.empty(); };
             bool r = false;
             std::unique_lock<std::mutex> lock(mutex);
+#ifdef ROTOR_ENABLE_METRICS
+            auto parked = clock_t::now();
+#endif
             if (!timer_nodes.empty()) {
                 r = cv.wait_until(lock, timer_nodes.begin()->deadline, predicate);
             } else {
                 cv.wait(lock, predicate);
                 r = true;
             }
+#ifdef ROTOR_ENABLE_METRICS
+            auto &gauges = root_sup.access<to::gauges>();
+            auto parked_time = duration_cast<std::chrono::nanoseconds>(clock_t::now() - parked).count();
+            gauges.add(gauges.parked_time, static_cast<std::uint64_t>(parked_time));
+#endif
             if (r) {
-                auto &queue = root_sup.access<to::queue>();
-                std::move(inbound.begin(), inbound.end(), std::back_inserter(queue));
-                inbound.clear();
+                drain(lock);
+            } else {
+                lock.unlock();
             }
-            lock.unlock();
             update_time();
             root_sup.do_process();
         }
@@ -52,14 +89,97 @@ void system_context_thread_t::run() noexcept {
 }
 
 void system_context_thread_t::check() noexcept {
-    auto &root_sup = *get_supervisor();
-    auto &queue = root_sup.access<to::queue>();
+    std::unique_lock<std::mutex> lock(mutex);
+    drain(lock);
+    update_time();
+}
+
+void system_context_thread_t::drain(std::unique_lock<std::mutex> &lock) noexcept {
+    auto &sup = *get_supervisor();
+    auto &queue = sup.access<to::queue>();
+#ifdef ROTOR_ENABLE_METRICS
+    sup.access<to::gauges>().record_inbound(inbound.size());
+#endif
+    std::move(inbound.begin(), inbound.end(), std::back_inserter(queue));
+    inbound.clear();
+    if (io_completed.empty()) {
+        lock.unlock();
+        return;
+    }
+    io_completions_t completed;
+    std::swap(completed, io_completed);
+    lock.unlock();
+    for (auto &handler : completed) {
+        --io_in_flight;
+        auto resources = handler->actor_ptr->access<to::resources>();
+        if (resources) {
+            resources->release();
+        }
+    }
+}
+
+bool system_context_thread_t::offload(message_ptr_t &message, handler_base_t &handler) noexcept {
+    if (io_threads.empty() || io_in_flight >= io_jobs_limit) {
+        return false;
+    }
+    auto resources = handler.actor_ptr->access<to::resources>();
+    if (resources) {
+        resources->acquire();
+    }
+    ++io_in_flight;
     do {
-        std::scoped_lock<std::mutex> lock(mutex);
-        std::move(inbound.begin(), inbound.end(), std::back_inserter(queue));
-        inbound.clear();
+        std::lock_guard<std::mutex> lock(io_mutex);
+        io_jobs.emplace_back(io_job_t{handler_ptr_t(&handler), message});
     } while (0);
-    update_time();
+    io_cv.notify_one();
+    return true;
+}
+
+void system_context_thread_t::io_loop() noexcept {
+    auto predicate = [&]() -> bool { return io_stop || !io_jobs.empty(); };
+    std::unique_lock<std::mutex> lock(io_mutex);
+    while (true) {
+        io_cv.wait(lock, predicate);
+        if (io_jobs.empty()) {
+            break;
+        }
+        auto job = std::move(io_jobs.front());
+        io_jobs.pop_front();
+        lock.unlock();
+
+#ifdef ROTOR_ENABLE_TRACING
+        auto tracer = job.message->tracer;
+        if (tracer) {
+            tracer->record(trace_point_t::handler_begin, *job.message, job.handler->actor_ptr->get_address().get());
+        }
+#endif
+#ifdef ROTOR_ENABLE_WATCHDOG
+        auto watchdog = get_watchdog().get();
+        auto slot = watchdog ? watchdog->get_slot() : nullptr;
+        auto &handler = *job.handler;
+        bool watched = slot && slot->begin(handler.actor_ptr->get_address().get(), handler.message_type,
+                                           handler.handler_type);
+#endif
+        job.handler->call_no_check(job.message);
+#ifdef ROTOR_ENABLE_WATCHDOG
+        if (watched) {
+            slot->end();
+        }
+#endif
+#ifdef ROTOR_ENABLE_TRACING
+        if (tracer) {
+            tracer->record(trace_point_t::handler_end, *job.message);
+        }
+#endif
+        job.message.reset();
+        do {
+            std::lock_guard<std::mutex> completion_lock(mutex);
+            io_completed.emplace_back(std::move(job.handler));
+        } while (0);
+        cv.notify_one();
+
+        lock.lock();
+    }
 }
 
 void system_context_thread_t::update_time() noexcept {
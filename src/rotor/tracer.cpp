@@ -0,0 +1,188 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "rotor/tracer.h"
+#include <cassert>
+#include <cstdlib>
+#include <cstdio>
+
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#define ROTOR_TRACER_DEMANGLE
+#endif
+
+using namespace rotor;
+using namespace rotor::details;
+
+namespace {
+
+std::atomic<std::uint64_t> last_tracer_id{0};
+
+std::size_t round_up(std::size_t capacity) noexcept {
+    std::size_t r = 1;
+    while (r < capacity) {
+        r <<= 1;
+    }
+    return r;
+}
+
+const char *phase(trace_point_t point) noexcept {
+    switch (point) {
+    case trace_point_t::handler_begin:
+        return "B";
+    case trace_point_t::handler_end:
+        return "E";
+    default:
+        return "i";
+    }
+}
+
+const char *category(trace_point_t point) noexcept {
+    switch (point) {
+    case trace_point_t::enqueue:
+        return "enqueue";
+    case trace_point_t::dispatch:
+        return "dispatch";
+    default:
+        return "handler";
+    }
+}
+
+} // namespace
+
+trace_ring_t::trace_ring_t(std::size_t capacity, std::uint32_t thread_id_) noexcept
+    : thread_id{thread_id_}, events{new event_t[round_up(capacity)]}, mask{round_up(capacity) - 1} {}
+
+tracer_t::tracer_t(const std::string &path, std::uint32_t sampling_, std::size_t ring_capacity_) noexcept
+    : id{++last_tracer_id}, sampling{sampling_ ? sampling_ : 1}, ring_capacity{ring_capacity_ ? ring_capacity_ : 1},
+      started{now()}, out(path, std::ios::out | std::ios::trunc) {
+    out << "[";
+}
+
+tracer_t::~tracer_t() {
+    if (flusher_thread.joinable()) {
+        do {
+            std::lock_guard<std::mutex> lock(flusher_mutex);
+            stop = true;
+        } while (0);
+        flusher_cv.notify_one();
+        flusher_thread.join();
+    }
+    flush();
+    out << "\n]\n";
+}
+
+std::error_code tracer_t::start(const clock_t::duration &interval) noexcept {
+    assert(!flusher_thread.joinable() && "flushing thread is already started");
+    try {
+        flusher_thread = std::thread([this, interval]() { flusher(interval); });
+    } catch (const std::system_error &err) {
+        return err.code();
+    }
+    return {};
+}
+
+void tracer_t::flusher(clock_t::duration interval) noexcept {
+    std::unique_lock<std::mutex> lock(flusher_mutex);
+    while (!flusher_cv.wait_for(lock, interval, [&]() { return stop; })) {
+        lock.unlock();
+        flush();
+        lock.lock();
+    }
+}
+
+bool tracer_t::good() const noexcept { return out.good(); }
+
+trace_ring_t &tracer_t::acquire_ring() noexcept {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto &ring = rings[std::this_thread::get_id()];
+    if (!ring) {
+        ring.reset(new trace_ring_t(ring_capacity, static_cast<std::uint32_t>(rings.size())));
+    }
+    return *ring;
+}
+
+const std::string &tracer_t::get_name(const void *message_type) noexcept {
+    auto it = names.find(message_type);
+    if (it != names.end()) {
+        return it->second;
+    }
+    auto mangled = static_cast<const char *>(message_type);
+    std::string name = mangled;
+#ifdef ROTOR_TRACER_DEMANGLE
+    int status = 0;
+    auto demangled = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+    if (status == 0 && demangled) {
+        name = demangled;
+    }
+    std::free(demangled);
+#endif
+    std::string escaped;
+    escaped.reserve(name.size());
+    for (auto c : name) {
+        if (c == '"' || c == '\\') {
+            escaped.push_back('\\');
+        }
+        escaped.push_back(c);
+    }
+    return names.emplace(message_type, std::move(escaped)).first->second;
+}
+
+void tracer_t::write(const trace_ring_t &ring, const event_t &event) noexcept {
+    char buff[256];
+    auto ts = event.timestamp >= started ? event.timestamp - started : 0;
+    auto n = std::snprintf(buff, sizeof(buff),
+                           "%s\n{\"ph\":\"%s\",\"cat\":\"%s\",\"ts\":%llu.%03u,\"pid\":%llu,\"tid\":%u,",
+                           first_event ? "" : ",", phase(event.point), category(event.point),
+                           static_cast<unsigned long long>(ts / 1000), static_cast<unsigned>(ts % 1000),
+                           static_cast<unsigned long long>(id), ring.thread_id);
+    out.write(buff, n);
+    first_event = false;
+    out << "\"name\":\"" << get_name(event.message_type) << "\"";
+    if (event.point == trace_point_t::handler_end) {
+        out << "}";
+        return;
+    }
+    if (event.point == trace_point_t::handler_begin) {
+        n = std::snprintf(buff, sizeof(buff), ",\"args\":{\"address\":\"%p\",\"actor\":\"%p\"}}", event.address,
+                          event.actor);
+    } else {
+        n = std::snprintf(buff, sizeof(buff), ",\"s\":\"t\",\"args\":{\"address\":\"%p\"}}", event.address);
+    }
+    out.write(buff, n);
+}
+
+std::size_t tracer_t::flush() noexcept {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::size_t written = 0;
+    for (auto &it : rings) {
+        auto &ring = *it.second;
+        if (!ring.announced) {
+            out << (first_event ? "" : ",") << "\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":" << id
+                << ",\"tid\":" << ring.thread_id << ",\"args\":{\"name\":\"rotor-" << ring.thread_id << "\"}}";
+            first_event = false;
+            ring.announced = true;
+        }
+        auto tail = ring.tail.load(std::memory_order_relaxed);
+        auto head = ring.head.load(std::memory_order_acquire);
+        for (auto i = tail; i != head; ++i) {
+            write(ring, ring.events[i & ring.mask]);
+        }
+        ring.tail.store(head, std::memory_order_release);
+        written += static_cast<std::size_t>(head - tail);
+    }
+    out.flush();
+    return written;
+}
+
+std::uint64_t tracer_t::get_dropped() const noexcept {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::uint64_t r = 0;
+    for (auto &it : rings) {
+        r += it.second->dropped.load(std::memory_order_relaxed);
+    }
+    return r;
+}
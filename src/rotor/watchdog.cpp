@@ -0,0 +1,123 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "rotor/watchdog.h"
+#include <boost/core/demangle.hpp>
+#include <cassert>
+#include <sstream>
+#include <vector>
+
+using namespace rotor;
+using namespace rotor::details;
+
+namespace {
+std::atomic<std::uint64_t> last_watchdog_id{0};
+}
+
+watchdog_scope_t::watchdog_scope_t(watchdog_t *watchdog) noexcept : previous{watchdog_slot} {
+    if (watchdog) {
+        watchdog_slot = watchdog->get_slot();
+    }
+}
+
+std::string slow_handler_t::to_string() const noexcept {
+    using boost::core::demangle;
+    using namespace std::chrono;
+    std::stringstream out;
+    out << "slow handler " << (handler_type ? demangle((const char *)handler_type) : "?") << " of " << address
+        << " for " << (message_type ? demangle((const char *)message_type) : "?") << " on thread " << thread_id
+        << ", running for " << duration_cast<milliseconds>(duration).count() << "ms";
+    return out.str();
+}
+
+watchdog_t::watchdog_t(const clock_t::duration &threshold_, callback_t callback_,
+                       const clock_t::duration &check_interval_) noexcept
+    : id{++last_watchdog_id}, threshold{threshold_},
+      check_interval{check_interval_ > clock_t::duration::zero() ? check_interval_ : threshold_ / 4},
+      callback{std::move(callback_)} {
+    assert(callback && "slow handlers callback is mandatory");
+}
+
+watchdog_t::~watchdog_t() {
+    if (!thread.joinable()) {
+        return;
+    }
+    do {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    } while (0);
+    cv.notify_one();
+    thread.join();
+}
+
+std::error_code watchdog_t::start() noexcept {
+    assert(!thread.joinable() && "monitor thread is already started");
+    try {
+        thread = std::thread([this]() { monitor(); });
+    } catch (const std::system_error &err) {
+        return err.code();
+    }
+    return {};
+}
+
+watchdog_slot_t &watchdog_t::acquire_slot() noexcept {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto &slot = slots[std::this_thread::get_id()];
+    if (!slot) {
+        slot.reset(new watchdog_slot_t(static_cast<std::uint32_t>(slots.size())));
+    }
+    return *slot;
+}
+
+void watchdog_t::monitor() noexcept {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stop) {
+        cv.wait_for(lock, check_interval, [&]() { return stop; });
+        if (!stop) {
+            lock.unlock();
+            check();
+            lock.lock();
+        }
+    }
+}
+
+std::size_t watchdog_t::check() noexcept {
+    std::vector<slow_handler_t> found;
+    auto now = clock_t::now();
+    do {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto &it : slots) {
+            auto &slot = it.second;
+            auto sequence = slot->sequence.load(std::memory_order_acquire);
+            if (sequence != slot->seen_sequence) {
+                slot->seen_sequence = sequence;
+                slot->seen_at = now;
+                continue;
+            }
+            /* idle, or the slow handler has been already reported */
+            if (!(sequence & 1) || slot->seen_at == clock_t::time_point{}) {
+                continue;
+            }
+            auto duration = now - slot->seen_at;
+            if (duration < threshold) {
+                continue;
+            }
+            auto info = slow_handler_t{slot->address.load(std::memory_order_relaxed),
+                                       slot->message_type.load(std::memory_order_relaxed),
+                                       slot->handler_type.load(std::memory_order_relaxed), slot->thread_id, duration};
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot->sequence.load(std::memory_order_relaxed) == sequence) {
+                slot->seen_at = clock_t::time_point{};
+                found.emplace_back(info);
+            }
+        }
+    } while (0);
+    detected.fetch_add(found.size(), std::memory_order_relaxed);
+    for (auto &info : found) {
+        callback(info);
+    }
+    return found.size();
+}
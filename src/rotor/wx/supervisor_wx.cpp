@@ -62,6 +62,9 @@ void supervisor_wx_t::shutdown() noexcept {
 }
 
 void supervisor_wx_t::enqueue(message_ptr_t message) noexcept {
+#ifdef ROTOR_ENABLE_METRICS
+    stamp(*message);
+#endif
     supervisor_ptr_t self{this};
     handler->CallAfter([self = std::move(self), message = std::move(message)]() {
         auto &sup = *self;
@@ -9,6 +9,8 @@
 #include "supervisor_test.h"
 #include "actor_test.h"
 #include "access.h"
+#include <iostream>
+#include <sstream>
 
 namespace r = rotor;
 namespace rt = rotor::test;
@@ -266,6 +268,16 @@ struct sample_actor6_t : public rt::actor_test_t {
     bool cancelled = false;
 };
 
+struct inspected_sup_t : public rt::supervisor_test_t {
+    using plugins_list_t = std::tuple<r::plugin::address_maker_plugin_t, r::plugin::locality_plugin_t,
+                                      r::plugin::delivery_plugin_t<r::plugin::inspected_local_delivery_t>,
+                                      r::plugin::lifetime_plugin_t, r::plugin::init_shutdown_plugin_t,
+                                      r::plugin::foreigners_support_plugin_t, r::plugin::child_manager_plugin_t,
+                                      r::plugin::starter_plugin_t>;
+
+    using rt::supervisor_test_t::supervisor_test_t;
+};
+
 TEST_CASE("on_initialize, on_start, simple on_shutdown (handled by plugin)", "[supervisor]") {
     destroyed = 0;
     r::system_context_t *system_context = new r::system_context_t{};
@@ -481,3 +493,34 @@ TEST_CASE("timers cancellation", "[actor]") {
     CHECK(sup->get_state() == r::state_t::SHUT_DOWN);
     CHECK(act->access<rt::to::timers_map>().empty());
 }
+
+TEST_CASE("inspected delivery", "[supervisor]") {
+    using D = r::plugin::inspected_local_delivery_t;
+    auto saved = D::get_threshold();
+    std::stringstream out;
+    auto cout_buff = std::cout.rdbuf(out.rdbuf());
+
+    D::set_threshold(D::disabled);
+    r::system_context_ptr_t system_context = new r::system_context_t();
+    auto sup = system_context->create_supervisor<inspected_sup_t>().timeout(rt::default_timeout).finish();
+    CHECK(D::get_threshold() == D::disabled);
+    sup->do_process();
+    CHECK(sup->get_state() == r::state_t::OPERATIONAL);
+    CHECK(out.str().empty());
+
+    D::set_threshold(0);
+    auto act = sup->create_actor<rt::actor_test_t>().timeout(rt::default_timeout).finish();
+    sup->do_process();
+    CHECK(act->get_state() == r::state_t::OPERATIONAL);
+    CHECK(out.str().find(">> ") != std::string::npos);
+    CHECK(out.str().find("subscription_confirmation_t") == std::string::npos);
+
+    D::set_threshold(9);
+    sup->do_shutdown();
+    sup->do_process();
+    CHECK(sup->get_state() == r::state_t::SHUT_DOWN);
+    CHECK(out.str().find("unsubscription_confirmation_t") != std::string::npos);
+
+    std::cout.rdbuf(cout_buff);
+    D::set_threshold(saved);
+}
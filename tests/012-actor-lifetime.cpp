@@ -231,3 +231,97 @@ TEST_CASE("double shutdown test (supervisor)", "[actor]") {
     REQUIRE(sup->get_children_count() == 0);
     REQUIRE(sup->active_timers.size() == 0);
 }
+
+TEST_CASE("minimal actor lifetime", "[actor]") {
+    struct tiny_actor_t : public r::minimal_actor_t {
+        using r::minimal_actor_t::minimal_actor_t;
+        using r::minimal_actor_t::get_plugin;
+        r::state_t &get_state() noexcept { return state; }
+    };
+
+    r::system_context_t system_context;
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto act = sup->create_actor<tiny_actor_t>().timeout(rt::default_timeout).finish();
+
+    CHECK(act->get_plugin(r::plugin::starter_plugin_t::class_identity));
+    CHECK(!act->get_plugin(r::plugin::link_server_plugin_t::class_identity));
+    CHECK(!act->get_plugin(r::plugin::link_client_plugin_t::class_identity));
+    CHECK(!act->get_plugin(r::plugin::registry_plugin_t::class_identity));
+    CHECK(!act->get_plugin(r::plugin::resources_plugin_t::class_identity));
+
+    sup->do_process();
+    REQUIRE(act->get_state() == r::state_t::OPERATIONAL);
+
+    act->do_shutdown();
+    sup->do_process();
+    REQUIRE(act->get_state() == r::state_t::SHUT_DOWN);
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+    REQUIRE(sup->get_leader_queue().size() == 0);
+    REQUIRE(sup->get_points().size() == 0);
+    CHECK(rt::empty(sup->get_subscription()));
+}
+
+struct pooled_actor_t : public sample_actor_t, r::pool_allocated_t {
+    using sample_actor_t::sample_actor_t;
+};
+
+TEST_CASE("pooled supervisor recycles memory of released actors", "[actor]") {
+    r::system_context_t system_context;
+    auto sup =
+        system_context.create_supervisor<rt::supervisor_test_t>().pool().timeout(rt::default_timeout).finish();
+    sup->do_process();
+
+    auto act = sup->create_actor<pooled_actor_t>().timeout(rt::default_timeout).finish();
+    sup->do_process();
+    REQUIRE(act->get_state() == r::state_t::OPERATIONAL);
+    auto prev_actor = static_cast<void *>(act.get());
+
+    auto destroyed_before = destroyed;
+    act->do_shutdown();
+    act.reset();
+    sup->do_process();
+    REQUIRE(destroyed == destroyed_before + 1);
+
+    act = sup->create_actor<pooled_actor_t>().timeout(rt::default_timeout).finish();
+    CHECK(static_cast<void *>(act.get()) == prev_actor);
+    sup->do_process();
+    REQUIRE(act->get_state() == r::state_t::OPERATIONAL);
+    CHECK(act->event_init_start == 1);
+    CHECK(act->event_start == 3);
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+    REQUIRE(sup->get_points().size() == 0);
+    CHECK(rt::empty(sup->get_subscription()));
+}
+
+TEST_CASE("pooled supervisor recycles addresses and handlers of released actors", "[actor]") {
+    r::system_context_t system_context;
+    auto sup =
+        system_context.create_supervisor<rt::supervisor_test_t>().pool().timeout(rt::default_timeout).finish();
+    sup->do_process();
+
+    auto act = sup->create_actor<sample_actor_t>().timeout(rt::default_timeout).finish();
+    sup->do_process();
+    REQUIRE(act->get_state() == r::state_t::OPERATIONAL);
+
+    auto cached_before = r::details::pool_cached();
+    act->do_shutdown();
+    act.reset();
+    sup->do_process();
+    auto cached_after = r::details::pool_cached();
+    CHECK(cached_after > cached_before);
+
+    act = sup->create_actor<sample_actor_t>().timeout(rt::default_timeout).finish();
+    sup->do_process();
+    REQUIRE(act->get_state() == r::state_t::OPERATIONAL);
+    CHECK(r::details::pool_cached() < cached_after);
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+}
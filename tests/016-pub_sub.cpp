@@ -8,6 +8,8 @@
 #include "rotor.hpp"
 #include "supervisor_test.h"
 #include "access.h"
+#include <algorithm>
+#include <iterator>
 
 namespace r = rotor;
 namespace rt = r::test;
@@ -63,6 +65,50 @@ struct sub_t : public r::actor_base_t {
     r::address_ptr_t pub_addr;
 };
 
+struct multi_sub_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        plugin.with_casted<r::plugin::starter_plugin_t>([this](auto &p) {
+            p.subscribe_actor(&multi_sub_t::on_confirmations);
+            for (auto &addr : addresses) {
+                p.subscribe_actor(&multi_sub_t::on_payload, addr);
+            }
+        });
+    }
+
+    void on_confirmations(r::message::subscription_t &message) noexcept {
+        ++batches;
+        points += message.payload.points.size();
+    }
+
+    void on_payload(r::message_t<payload_t> &) noexcept { ++received; }
+
+    std::vector<r::address_ptr_t> addresses;
+    std::size_t batches = 0;
+    std::size_t points = 0;
+    std::size_t received = 0;
+};
+
+struct unsub_observer_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        plugin.with_casted<r::plugin::starter_plugin_t>([this](auto &p) {
+            p.subscribe_actor(&unsub_observer_t::on_unsubscriptions, target);
+        });
+    }
+
+    void on_unsubscriptions(r::message::unsubscription_t &message) noexcept {
+        ++batches;
+        points += message.payload.points.size();
+    }
+
+    r::address_ptr_t target;
+    std::size_t batches = 0;
+    std::size_t points = 0;
+};
+
 TEST_CASE("ping-pong", "[supervisor]") {
     r::system_context_t system_context;
 
@@ -84,3 +130,153 @@ TEST_CASE("ping-pong", "[supervisor]") {
     REQUIRE(sup->get_points().size() == 0);
     CHECK(rt::empty(sup->get_subscription()));
 }
+
+TEST_CASE("actor subscriptions are confirmed by single message", "[supervisor]") {
+    r::system_context_t system_context;
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto act = sup->create_actor<multi_sub_t>().timeout(rt::default_timeout).finish();
+    for (std::size_t i = 0; i < 30; ++i) {
+        act->addresses.emplace_back(sup->create_address());
+    }
+    sup->do_process();
+
+    CHECK(act->access<rt::to::state>() == r::state_t::OPERATIONAL);
+    CHECK(act->batches == 1);
+    CHECK(act->points == 30 + 1);
+
+    for (auto &addr : act->addresses) {
+        sup->send<payload_t>(addr);
+    }
+    sup->do_process();
+    CHECK(act->received == 30);
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+    REQUIRE(sup->get_leader_queue().size() == 0);
+    REQUIRE(sup->get_points().size() == 0);
+    CHECK(rt::empty(sup->get_subscription()));
+}
+
+TEST_CASE("actor unsubscriptions are batched", "[supervisor]") {
+    r::system_context_t system_context;
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto act = sup->create_actor<multi_sub_t>().timeout(rt::default_timeout).finish();
+    for (std::size_t i = 0; i < 30; ++i) {
+        act->addresses.emplace_back(sup->create_address());
+    }
+    auto observer = sup->create_actor<unsub_observer_t>().timeout(rt::default_timeout).finish();
+    observer->target = act->get_address();
+    sup->do_process();
+    REQUIRE(act->access<rt::to::state>() == r::state_t::OPERATIONAL);
+    REQUIRE(observer->access<rt::to::state>() == r::state_t::OPERATIONAL);
+
+    act->do_shutdown();
+    sup->do_process();
+    CHECK(act->access<rt::to::state>() == r::state_t::SHUT_DOWN);
+    CHECK(observer->batches == 2);
+    CHECK(observer->points > 30);
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+    REQUIRE(sup->get_leader_queue().size() == 0);
+    REQUIRE(sup->get_points().size() == 0);
+    CHECK(rt::empty(sup->get_subscription()));
+}
+
+TEST_CASE("subscription container lookup", "[supervisor]") {
+    r::system_context_t system_context;
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto act = sup->create_actor<multi_sub_t>().timeout(rt::default_timeout).finish();
+    sup->do_process();
+    auto handler = r::wrap_handler(*act, &multi_sub_t::on_payload);
+
+    std::vector<r::address_ptr_t> addresses;
+    r::subscription_container_t container;
+    auto count = r::subscription_container_t::index_threshold * 2;
+    for (std::size_t i = 0; i < count; ++i) {
+        auto &addr = addresses.emplace_back(sup->create_address());
+        r::subscription_point_t point(handler, addr, act.get(), r::owner_tag_t::ANONYMOUS);
+        container.emplace_back(new r::subscription_info_t(point, true, true, r::subscription_info_t::ESTABLISHED));
+        REQUIRE(container.size() == i + 1);
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        auto it = container.find(r::subscription_point_t{handler, addresses[i]});
+        REQUIRE(it != container.end());
+        CHECK((*it)->address == addresses[i]);
+    }
+    CHECK(container.find(r::subscription_point_t{handler, sup->get_address()}) == container.end());
+
+    for (std::size_t i = 0; i < count; i += 2) {
+        container.erase(container.find(r::subscription_point_t{handler, addresses[i]}));
+    }
+    CHECK(container.size() == count / 2);
+    for (std::size_t i = 0; i < count; ++i) {
+        auto found = container.find(r::subscription_point_t{handler, addresses[i]}) != container.end();
+        CHECK(found == (i % 2 == 1));
+    }
+
+    auto it = container.begin();
+    for (std::size_t i = 1; i < count; i += 2, ++it) {
+        CHECK((*it)->address == addresses[i]);
+    }
+    container.clear();
+    CHECK(container.empty());
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+}
+
+TEST_CASE("subscription container lookup with duplicates", "[supervisor]") {
+    r::system_context_t system_context;
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto act = sup->create_actor<multi_sub_t>().timeout(rt::default_timeout).finish();
+    sup->do_process();
+    auto handler = r::wrap_handler(*act, &multi_sub_t::on_payload);
+
+    std::vector<r::address_ptr_t> addresses;
+    for (std::size_t i = 0; i < 5; ++i) {
+        addresses.emplace_back(sup->create_address());
+    }
+
+    /* the reference semantics: the last inserted equal point */
+    auto linear_find = [&](r::subscription_container_t &container, const r::subscription_point_t &point) {
+        auto rit = std::find_if(container.rbegin(), container.rend(), [&](auto &info) { return *info == point; });
+        return rit == container.rend() ? container.end() : std::prev(rit.base());
+    };
+
+    r::subscription_container_t container;
+    auto count = r::subscription_container_t::index_threshold * 3;
+    for (std::size_t i = 0; i < count; ++i) {
+        r::subscription_point_t point(handler, addresses[i % addresses.size()], act.get(), r::owner_tag_t::ANONYMOUS);
+        container.emplace_back(new r::subscription_info_t(point, true, true, r::subscription_info_t::ESTABLISHED));
+
+        for (auto &addr : addresses) {
+            auto point = r::subscription_point_t{handler, addr};
+            CHECK(container.find(point) == linear_find(container, point));
+        }
+    }
+    REQUIRE(container.size() > r::subscription_container_t::index_threshold);
+
+    /* erasing the last duplicate reveals the previous one */
+    for (std::size_t i = 0; i < count / 2; ++i) {
+        auto point = r::subscription_point_t{handler, addresses[i % addresses.size()]};
+        auto it = container.find(point);
+        REQUIRE(it != container.end());
+        CHECK(it == linear_find(container, point));
+        container.erase(it);
+        CHECK(container.find(point) == linear_find(container, point));
+    }
+    container.clear();
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+}
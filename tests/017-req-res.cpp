@@ -486,6 +486,57 @@ TEST_CASE("request-response timeout", "[actor]") {
     REQUIRE(sup->active_timers.size() == 0);
 }
 
+TEST_CASE("request round-trip statistics", "[supervisor]") {
+    r::system_context_t system_context;
+
+    bool enabled = GENERATE(false, true);
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>()
+                   .request_stats(enabled)
+                   .timeout(rt::default_timeout)
+                   .finish();
+    auto good_actor = sup->create_actor<good_actor_t>().timeout(rt::default_timeout).finish();
+    auto bad_actor = sup->create_actor<bad_actor_t>().timeout(rt::default_timeout).finish();
+    sup->do_process();
+    REQUIRE(good_actor->res_val == 5);
+    REQUIRE(sup->active_timers.size() == 1);
+
+    auto timer_it = *sup->active_timers.begin();
+    ((r::actor_base_t *)sup.get())
+        ->access<rt::to::on_timer_trigger, r::request_id_t, bool>(timer_it->request_id, false);
+    sup->active_timers.clear();
+    sup->do_process();
+    REQUIRE(bad_actor->ec == r::error_code_t::request_timeout);
+
+    auto stats = sup->get_request_stats<request_sample_t>();
+#ifdef ROTOR_ENABLE_METRICS
+    if (enabled) {
+        REQUIRE(stats);
+        CHECK(stats->sent == 2);
+        CHECK(stats->responded == 1);
+        CHECK(stats->timed_out == 1);
+        CHECK(stats->cancelled == 0);
+        CHECK(stats->in_flight == 0);
+        CHECK(stats->round_trip.count() == 1);
+        CHECK(stats->in_flight_depth.count() == 2);
+        CHECK(stats->in_flight_depth.max() == 2);
+        CHECK(stats->timeout_rate() == Approx(0.5));
+        CHECK(sup->get_request_stats().size() > 1); /* also actors initialization requests */
+
+        sup->reset_request_stats();
+        CHECK(sup->get_request_stats<request_sample_t>()->sent == 0);
+    } else {
+        CHECK(!stats);
+        CHECK(sup->get_request_stats().empty());
+    }
+#else
+    CHECK(!stats);
+#endif
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+}
+
 TEST_CASE("response with custom error", "[actor]") {
     r::system_context_t system_context;
 
@@ -566,8 +617,14 @@ TEST_CASE("request-response successfull delivery, twice", "[actor]") {
     REQUIRE(actor->res_val == 5 * 2);
     REQUIRE(actor->ec == r::error_code_t::success);
 
+    std::size_t mapped = 0;
+    auto &address_mapping = actor->access<rt::to::address_mapping>();
+    address_mapping.each_subscription([&](auto &) { ++mapped; });
+    CHECK(mapped == 1);
+
     sup->do_shutdown();
     sup->do_process();
+    CHECK(address_mapping.empty());
 
     REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
     REQUIRE(sup->get_leader_queue().size() == 0);
@@ -540,3 +540,37 @@ TEST_CASE("proper shutdown order, defined by linkage", "[actor]") {
     CHECK(act_2->shutdown_event == 2);
     CHECK(act_3->shutdown_event == 3);
 }
+
+TEST_CASE("link plugins subscriptions are lazy", "[actor]") {
+    r::system_context_t system_context;
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto act_s = sup->create_actor<rt::actor_test_t>().timeout(rt::default_timeout).finish();
+    auto act_c = sup->create_actor<rt::actor_test_t>().timeout(rt::default_timeout).finish();
+    sup->do_process();
+    REQUIRE(act_c->get_state() == r::state_t::OPERATIONAL);
+
+    auto subscriptions = [](auto &actor, const void *identity) {
+        auto plugin = actor->template access<rt::to::get_plugin>(identity);
+        return plugin->template access<rt::to::own_subscriptions>().size();
+    };
+    auto link_client_id = r::plugin::link_client_plugin_t::class_identity;
+    auto link_server_id = r::plugin::link_server_plugin_t::class_identity;
+    auto registry_id = r::plugin::registry_plugin_t::class_identity;
+
+    CHECK(subscriptions(act_c, link_client_id) == 0);
+    CHECK(subscriptions(act_c, registry_id) == 0);
+    CHECK(subscriptions(act_s, link_server_id) == 1);
+
+    auto plugin = act_c->access<rt::to::get_plugin>(link_client_id);
+    static_cast<r::plugin::link_client_plugin_t *>(plugin)->link(act_s->get_address());
+    sup->do_process();
+    CHECK(subscriptions(act_c, link_client_id) == 2);
+    CHECK(subscriptions(act_s, link_server_id) == 3);
+
+    sup->do_shutdown();
+    sup->do_process();
+    CHECK(act_c->get_state() == r::state_t::SHUT_DOWN);
+    CHECK(act_s->get_state() == r::state_t::SHUT_DOWN);
+    CHECK(sup->get_state() == r::state_t::SHUT_DOWN);
+}
@@ -49,6 +49,44 @@ struct my_supervisor_t : public rt::supervisor_test_t {
     std::uint32_t shutdown_finish_count = 0;
 };
 
+struct payload_t {};
+
+struct foreign_sub_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        plugin.with_casted<r::plugin::starter_plugin_t>([this](auto &p) {
+            for (auto &addr : addresses) {
+                p.subscribe_actor(&foreign_sub_t::on_payload, addr);
+            }
+        });
+    }
+
+    void on_payload(r::message_t<payload_t> &) noexcept { ++received; }
+
+    std::vector<r::address_ptr_t> addresses;
+    std::size_t received = 0;
+};
+
+struct commit_observer_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        plugin.with_casted<r::plugin::starter_plugin_t>([this](auto &p) {
+            auto &sup_addr = supervisor->get_address();
+            p.subscribe_actor(&commit_observer_t::on_commits, sup_addr);
+        });
+    }
+
+    void on_commits(r::message::commit_unsubscription_t &message) noexcept {
+        ++batches;
+        points += message.payload.points.size();
+    }
+
+    std::size_t batches = 0;
+    std::size_t points = 0;
+};
+
 TEST_CASE("two supervisors, different localities, shutdown 2nd", "[supervisor]") {
     r::system_context_t system_context;
 
@@ -252,3 +290,44 @@ TEST_CASE("two supervisors, down internal first, same locality", "[supervisor]")
     REQUIRE(sup2->get_points().size() == 0);
     REQUIRE(rt::empty(sup2->get_subscription()));
 }
+
+TEST_CASE("two supervisors, foreign unsubscriptions are committed at once", "[supervisor]") {
+    r::system_context_t system_context;
+
+    const char locality[] = "locality";
+    auto sup1 =
+        system_context.create_supervisor<my_supervisor_t>().timeout(rt::default_timeout).locality(locality).finish();
+    auto sup2 = sup1->create_actor<my_supervisor_t>().timeout(rt::default_timeout).locality(locality).finish();
+    auto observer = sup1->create_actor<commit_observer_t>().timeout(rt::default_timeout).finish();
+    auto act = sup2->create_actor<foreign_sub_t>().timeout(rt::default_timeout).finish();
+    for (std::size_t i = 0; i < 20; ++i) {
+        act->addresses.emplace_back(sup1->create_address());
+    }
+
+    sup1->do_process();
+    REQUIRE(act->access<rt::to::state>() == r::state_t::OPERATIONAL);
+
+    for (auto &addr : act->addresses) {
+        sup1->send<payload_t>(addr);
+    }
+    sup1->do_process();
+    CHECK(act->received == 20);
+
+    act->do_shutdown();
+    sup1->do_process();
+    CHECK(act->access<rt::to::state>() == r::state_t::SHUT_DOWN);
+    CHECK(observer->batches == 1);
+    CHECK(observer->points == 20);
+
+    sup1->do_shutdown();
+    sup1->do_process();
+    REQUIRE(sup1->get_state() == r::state_t::SHUT_DOWN);
+
+    REQUIRE(sup1->get_leader_queue().size() == 0);
+    REQUIRE(sup1->get_points().size() == 0);
+    REQUIRE(rt::empty(sup1->get_subscription()));
+
+    REQUIRE(sup2->get_leader_queue().size() == 0);
+    REQUIRE(sup2->get_points().size() == 0);
+    REQUIRE(rt::empty(sup2->get_subscription()));
+}
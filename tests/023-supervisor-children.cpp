@@ -324,6 +324,36 @@ TEST_CASE("shutdown_failed policy", "[supervisor]") {
     REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
 }
 
+TEST_CASE("shutdown_failed policy, the failed child does not block others", "[supervisor]") {
+    r::system_context_t system_context;
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>()
+                   .policy(r::supervisor_policy_t::shutdown_failed)
+                   .timeout(rt::default_timeout)
+                   .finish();
+    auto act_failed = sup->create_actor<sample_actor_t>().timeout(rt::default_timeout).finish();
+    auto act_ok = sup->create_actor<sample_actor_t>().timeout(rt::default_timeout).finish();
+
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::INITIALIZING);
+    REQUIRE(act_failed->get_state() == r::state_t::INITIALIZING);
+    REQUIRE(act_ok->get_state() == r::state_t::INITIALIZING);
+
+    auto &init_req = act_failed->access<to::init_request>();
+    REQUIRE(init_req);
+    sup->do_invoke_timer(init_req->payload.id);
+    act_ok->confirm_init();
+    sup->do_process();
+
+    CHECK(act_failed->get_state() == r::state_t::SHUT_DOWN);
+    CHECK(act_ok->get_state() == r::state_t::OPERATIONAL);
+    CHECK(sup->get_state() == r::state_t::OPERATIONAL);
+
+    sup->do_shutdown();
+    sup->do_process();
+    CHECK(act_ok->get_state() == r::state_t::SHUT_DOWN);
+    CHECK(sup->get_state() == r::state_t::SHUT_DOWN);
+}
+
 TEST_CASE("shutdown_self policy", "[supervisor]") {
     r::system_context_t system_context;
 
@@ -639,3 +669,65 @@ TEST_CASE("1 child is initializing, and another one started, and then shutted do
     sup->do_shutdown();
     sup->do_process();
 }
+
+TEST_CASE("spawn batch of actors", "[supervisor]") {
+    rt::system_context_test_t system_context;
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto actors = sup->spawn_n<rt::actor_test_t>(
+        5, [](auto builder) { return std::move(builder).timeout(rt::default_timeout).finish(); });
+    REQUIRE(actors.size() == 5);
+
+    actors[2]->access<rt::to::resources>()->acquire();
+    sup->do_process();
+    CHECK(sup->get_state() == r::state_t::INITIALIZING);
+    CHECK(actors[0]->get_state() == r::state_t::OPERATIONAL);
+    CHECK(actors[2]->get_state() == r::state_t::INITIALIZING);
+    CHECK(actors[4]->get_state() == r::state_t::OPERATIONAL);
+    // supervisor own init timer and single group timer for all children
+    CHECK(sup->active_timers.size() == 2);
+
+    actors[2]->access<rt::to::resources>()->release();
+    sup->do_process();
+    CHECK(sup->get_state() == r::state_t::OPERATIONAL);
+    for (auto &act : actors) {
+        CHECK(act->get_state() == r::state_t::OPERATIONAL);
+    }
+    CHECK(sup->active_timers.size() == 0);
+
+    sup->do_shutdown();
+    sup->do_process();
+    CHECK(sup->get_state() == r::state_t::SHUT_DOWN);
+    for (auto &act : actors) {
+        CHECK(act->get_state() == r::state_t::SHUT_DOWN);
+    }
+}
+
+TEST_CASE("spawned batch of actors, group init deadline", "[supervisor]") {
+    r::system_context_t system_context;
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::OPERATIONAL);
+
+    auto actors = sup->spawn_n<sample_actor_t>(
+        3, [](auto builder) { return std::move(builder).timeout(rt::default_timeout).finish(); });
+    sup->do_process();
+    actors[1]->confirm_init();
+    sup->do_process();
+    CHECK(actors[0]->get_state() == r::state_t::INITIALIZING);
+    CHECK(actors[1]->get_state() == r::state_t::OPERATIONAL);
+    CHECK(actors[2]->get_state() == r::state_t::INITIALIZING);
+
+    REQUIRE(sup->active_timers.size() == 1);
+    sup->do_invoke_timer(sup->get_timer(0));
+    sup->do_process();
+    CHECK(sup->get_state() == r::state_t::OPERATIONAL);
+    CHECK(actors[0]->get_state() == r::state_t::SHUT_DOWN);
+    CHECK(actors[1]->get_state() == r::state_t::OPERATIONAL);
+    CHECK(actors[2]->get_state() == r::state_t::SHUT_DOWN);
+
+    sup->do_shutdown();
+    sup->do_process();
+    CHECK(sup->get_state() == r::state_t::SHUT_DOWN);
+    CHECK(actors[1]->get_state() == r::state_t::SHUT_DOWN);
+}
@@ -0,0 +1,204 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "catch.hpp"
+#include "rotor.hpp"
+#include "rotor/coroutine.hpp"
+#include "supervisor_test.h"
+#include "access.h"
+#include <algorithm>
+
+namespace r = rotor;
+namespace rt = r::test;
+
+struct response_sample_t {
+    int value;
+};
+
+struct request_sample_t {
+    using response_t = response_sample_t;
+
+    int value;
+};
+
+using traits_t = r::request_traits_t<request_sample_t>;
+
+struct co_actor_t : public r::actor_base_t {
+    // clang-format off
+    using plugins_list_t = std::tuple<
+        r::plugin::address_maker_plugin_t,
+        r::plugin::lifetime_plugin_t,
+        r::plugin::init_shutdown_plugin_t,
+        r::plugin::link_server_plugin_t,
+        r::plugin::link_client_plugin_t,
+        r::plugin::registry_plugin_t,
+        r::plugin::resources_plugin_t,
+        r::plugin::starter_plugin_t,
+        r::plugin::coroutine_plugin_t>;
+    // clang-format on
+
+    using r::actor_base_t::actor_base_t;
+
+    r::address_ptr_t responder;
+    int steps = 2;
+    int res_val = 0;
+    int response_handler_calls = 0;
+    std::error_code ec;
+    bool finished = false;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) {
+            p.subscribe_actor(&co_actor_t::on_request);
+            p.subscribe_actor(&co_actor_t::on_response);
+        });
+    }
+
+    void on_start() noexcept override {
+        r::actor_base_t::on_start();
+        if (!responder) {
+            responder = address;
+        }
+        process();
+    }
+
+    r::coroutine_t process() noexcept {
+        for (int i = 0; i < steps; ++i) {
+            auto res = co_await request<request_sample_t>(responder, res_val + 1).co_send(rt::default_timeout);
+            ec = res->payload.ec;
+            if (ec) {
+                break;
+            }
+            res_val = res->payload.res.value;
+        }
+        finished = true;
+    }
+
+    void on_request(traits_t::request::message_t &msg) noexcept {
+        reply_to(msg, msg.payload.request_payload.value * 2);
+    }
+
+    void on_response(traits_t::response::message_t &) noexcept { ++response_handler_calls; }
+};
+
+struct silent_actor_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        plugin.with_casted<r::plugin::starter_plugin_t>(
+            [](auto &p) { p.subscribe_actor(&silent_actor_t::on_request); });
+    }
+
+    void on_request(traits_t::request::message_t &) noexcept {}
+};
+
+TEST_CASE("coroutine: sequential requests", "[actor]") {
+    r::system_context_t system_context;
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto actor = sup->create_actor<co_actor_t>().timeout(rt::default_timeout).finish();
+    sup->do_process();
+
+    CHECK(actor->finished);
+    CHECK(!actor->ec);
+    CHECK(actor->res_val == 6);
+    CHECK(actor->response_handler_calls == 0);
+    CHECK(sup->active_timers.size() == 0);
+
+    auto plugin = r::plugin::coroutine_plugin_t::get(*actor);
+    REQUIRE(plugin);
+    CHECK(plugin->suspended() == 0);
+    CHECK(plugin->cached_frames() == 1);
+
+    actor->steps = 1;
+    actor->process();
+    sup->do_process();
+    CHECK(actor->res_val == 14);
+    CHECK(plugin->cached_frames() == 1);
+
+    sup->do_shutdown();
+    sup->do_process();
+
+    CHECK(sup->get_state() == r::state_t::SHUT_DOWN);
+    CHECK(sup->get_leader_queue().size() == 0);
+    CHECK(sup->get_points().size() == 0);
+    CHECK(rt::empty(sup->get_subscription()));
+    CHECK(sup->get_requests().size() == 0);
+}
+
+TEST_CASE("coroutine: request timeout delays shutdown", "[actor]") {
+    r::system_context_t system_context;
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto silent = sup->create_actor<silent_actor_t>().timeout(rt::default_timeout).finish();
+    sup->do_process();
+
+    auto actor = sup->create_actor<co_actor_t>().timeout(rt::default_timeout).finish();
+    actor->responder = silent->get_address();
+    sup->do_process();
+
+    auto plugin = r::plugin::coroutine_plugin_t::get(*actor);
+    REQUIRE(plugin);
+    CHECK(plugin->suspended() == 1);
+    CHECK(!actor->finished);
+    REQUIRE(sup->active_timers.size() == 1);
+
+    actor->do_shutdown();
+    sup->do_process();
+    CHECK(actor->access<rt::to::state>() == r::state_t::SHUTTING_DOWN);
+
+    auto timer_it = *sup->active_timers.begin();
+    sup->do_invoke_timer(timer_it->request_id);
+    sup->do_process();
+
+    CHECK(actor->finished);
+    CHECK(actor->ec == r::error_code_t::request_timeout);
+    CHECK(actor->access<rt::to::state>() == r::state_t::SHUT_DOWN);
+
+    sup->do_shutdown();
+    sup->do_process();
+
+    CHECK(sup->get_state() == r::state_t::SHUT_DOWN);
+    CHECK(sup->get_leader_queue().size() == 0);
+    CHECK(sup->get_points().size() == 0);
+    CHECK(rt::empty(sup->get_subscription()));
+    CHECK(sup->get_requests().size() == 0);
+}
+
+TEST_CASE("coroutine: frames pool is bounded", "[actor]") {
+    r::system_context_t system_context;
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto actor = sup->create_actor<silent_actor_t>().timeout(rt::default_timeout).finish();
+    auto co_actor = sup->create_actor<co_actor_t>().timeout(rt::default_timeout).finish();
+    co_actor->responder = actor->get_address();
+    sup->do_process();
+
+    auto plugin = r::plugin::coroutine_plugin_t::get(*co_actor);
+    REQUIRE(plugin);
+    auto max = r::plugin::coroutine_plugin_t::max_cached_frames;
+
+    std::vector<void *> frames;
+    for (std::size_t i = 0; i < max + 4; ++i) {
+        auto frame = plugin->allocate_frame(64);
+        REQUIRE(frame);
+        frames.push_back(frame);
+    }
+    for (auto frame : frames) {
+        plugin->deallocate_frame(frame, 64);
+    }
+    CHECK(plugin->cached_frames() == max);
+
+    auto frame = plugin->allocate_frame(64);
+    CHECK(plugin->cached_frames() == max - 1);
+    CHECK(std::find(frames.begin(), frames.end(), frame) != frames.end());
+    plugin->deallocate_frame(frame, 64);
+
+    auto timer_it = *sup->active_timers.begin();
+    sup->do_invoke_timer(timer_it->request_id);
+    sup->do_shutdown();
+    sup->do_process();
+    CHECK(sup->get_state() == r::state_t::SHUT_DOWN);
+}
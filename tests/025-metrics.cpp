@@ -0,0 +1,267 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "catch.hpp"
+#include "rotor.hpp"
+#include "access.h"
+#include "supervisor_test.h"
+
+namespace r = rotor;
+namespace rt = r::test;
+
+struct ping_t {};
+struct pong_t {};
+
+struct pinger_t : public r::actor_base_t {
+    std::uint32_t pings_left = 10;
+    std::uint32_t pong_received = 0;
+
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&pinger_t::on_pong); });
+    }
+
+    void on_start() noexcept override {
+        r::actor_base_t::on_start();
+        send<ping_t>(ponger_addr);
+    }
+
+    void on_pong(r::message_t<pong_t> &) noexcept {
+        ++pong_received;
+        if (--pings_left) {
+            send<ping_t>(ponger_addr);
+        }
+    }
+
+    r::address_ptr_t ponger_addr;
+};
+
+struct ponger_t : public r::actor_base_t {
+    // clang-format off
+    using plugins_list_t = std::tuple<
+        r::plugin::address_maker_plugin_t,
+        r::plugin::lifetime_plugin_t,
+        r::plugin::init_shutdown_plugin_t,
+        r::plugin::link_server_plugin_t,
+        r::plugin::link_client_plugin_t,
+        r::plugin::registry_plugin_t,
+        r::plugin::resources_plugin_t,
+        r::plugin::starter_plugin_t,
+        r::plugin::metrics_plugin_t>;
+    // clang-format on
+
+    std::uint32_t ping_received = 0;
+
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&ponger_t::on_ping); });
+    }
+
+    void on_ping(r::message_t<ping_t> &) noexcept {
+        ++ping_received;
+        send<pong_t>(pinger_addr);
+    }
+
+    r::address_ptr_t pinger_addr;
+};
+
+TEST_CASE("histogram", "[metrics]") {
+    using H = r::histogram_t;
+
+    for (std::uint64_t value : {0ull, 1ull, 7ull, 8ull, 15ull, 16ull, 100ull, 1000ull, 123456789ull}) {
+        auto bucket = H::bucket_of(value);
+        CHECK(value <= H::upper_bound(bucket));
+        if (bucket) {
+            CHECK(value > H::upper_bound(bucket - 1));
+        }
+    }
+    CHECK(H::bucket_of(1ull << 50) == H::buckets - 1);
+
+    H h;
+    CHECK(h.count() == 0);
+    CHECK(h.percentile(50) == 0);
+
+    for (std::uint64_t i = 1; i <= 1000; ++i) {
+        h.record(i);
+    }
+    CHECK(h.count() == 1000);
+    CHECK(h.min() == 1);
+    CHECK(h.max() == 1000);
+    CHECK(h.mean() == Approx(500.5));
+    auto p50 = h.percentile(50);
+    CHECK(p50 >= 500);
+    CHECK(p50 <= 500 * 1.125);
+    CHECK(h.percentile(100) == 1000);
+    CHECK(h.percentile(0) == 1);
+
+    H other;
+    other.record(5000);
+    h.merge(other);
+    CHECK(h.count() == 1001);
+    CHECK(h.max() == 5000);
+
+    h.reset();
+    CHECK(h.count() == 0);
+    CHECK(h.max() == 0);
+}
+
+TEST_CASE("per-actor metrics", "[metrics]") {
+    r::system_context_t system_context;
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+
+    auto pinger = sup->create_actor<pinger_t>().timeout(rt::default_timeout).finish();
+    auto ponger = sup->create_actor<ponger_t>().timeout(rt::default_timeout).finish();
+    pinger->ponger_addr = ponger->get_address();
+    ponger->pinger_addr = pinger->get_address();
+
+    CHECK(!r::plugin::metrics_plugin_t::get(*pinger));
+    auto metrics = r::plugin::metrics_plugin_t::get(*ponger);
+    REQUIRE(metrics);
+
+    sup->do_process();
+    REQUIRE(pinger->pong_received == 10);
+    REQUIRE(ponger->ping_received == 10);
+
+#ifdef ROTOR_ENABLE_METRICS
+    CHECK(metrics->get_messages() >= 10);
+    auto &per_type = metrics->get_message_metrics();
+    auto it = per_type.find(r::message_t<ping_t>::message_type);
+    REQUIRE(it != per_type.end());
+    auto &ping_metrics = it->second;
+    CHECK(ping_metrics.count == 10);
+    CHECK(ping_metrics.handler_time.count() == 10);
+    CHECK(ping_metrics.queue_time.count() == 10);
+    CHECK(ping_metrics.handler_time.max() <= metrics->get_handlers_time());
+    CHECK(per_type.count(r::message_t<pong_t>::message_type) == 0);
+
+    metrics->reset();
+    CHECK(metrics->get_messages() == 0);
+    CHECK(metrics->get_message_metrics().empty());
+#endif
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+    CHECK(rt::empty(sup->get_subscription()));
+}
+
+TEST_CASE("supervisor gauges", "[metrics]") {
+    r::system_context_t system_context;
+    const char locality1[] = "abc";
+    const char locality2[] = "def";
+    auto sup1 = system_context.create_supervisor<rt::supervisor_test_t>()
+                    .locality(locality1)
+                    .timeout(rt::default_timeout)
+                    .finish();
+    auto sup2 =
+        sup1->create_actor<rt::supervisor_test_t>().locality(locality2).timeout(rt::default_timeout).finish();
+
+    auto pinger = sup1->create_actor<pinger_t>().timeout(rt::default_timeout).finish();
+    auto ponger = sup2->create_actor<ponger_t>().timeout(rt::default_timeout).finish();
+    pinger->ponger_addr = ponger->get_address();
+    ponger->pinger_addr = pinger->get_address();
+
+    auto stats = sup1->get_stats();
+    CHECK(stats.process_calls == 0);
+    CHECK(stats.processed == 0);
+
+    auto process = [&]() {
+        for (int i = 0; i < 100; ++i) {
+            sup1->do_process();
+            sup2->do_process();
+        }
+    };
+    process();
+    REQUIRE(pinger->access<rt::to::state>() == r::state_t::OPERATIONAL);
+    REQUIRE(ponger->access<rt::to::state>() == r::state_t::OPERATIONAL);
+
+    /* the initial ping might be sent before the ponger has been subscribed */
+    pinger->pings_left = 10;
+    pinger->pong_received = 0;
+    pinger->send<ping_t>(pinger->ponger_addr);
+    process();
+    REQUIRE(pinger->pong_received == 10);
+
+    stats = sup1->get_stats();
+#ifdef ROTOR_ENABLE_METRICS
+    CHECK(stats.process_calls > 0);
+    CHECK(stats.processed >= 10);
+    CHECK(stats.max_processed > 0);
+    CHECK(stats.max_processed <= stats.processed);
+    CHECK(stats.queue_high_water > 0);
+    CHECK(stats.cross_enqueued >= 10);
+    CHECK(sup2->get_stats().cross_enqueued >= 10);
+#endif
+    CHECK(stats.inbound_depth == 0);
+    CHECK(stats.parked_time == 0);
+
+    sup1->do_shutdown();
+    process();
+    CHECK(sup1->get_state() == r::state_t::SHUT_DOWN);
+    CHECK(sup2->get_state() == r::state_t::SHUT_DOWN);
+}
+
+TEST_CASE("queueing delay statistics", "[metrics]") {
+    r::system_context_t system_context;
+    bool enabled = GENERATE(false, true);
+    auto sup1 = system_context.create_supervisor<rt::supervisor_test_t>()
+                    .queueing_stats(enabled)
+                    .timeout(rt::default_timeout)
+                    .finish();
+    auto sup2 = sup1->create_actor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+
+    auto pinger = sup1->create_actor<pinger_t>().timeout(rt::default_timeout).finish();
+    auto ponger = sup2->create_actor<ponger_t>().timeout(rt::default_timeout).finish();
+    pinger->ponger_addr = ponger->get_address();
+    ponger->pinger_addr = pinger->get_address();
+    sup1->do_process();
+    REQUIRE(pinger->access<rt::to::state>() == r::state_t::OPERATIONAL);
+    REQUIRE(ponger->access<rt::to::state>() == r::state_t::OPERATIONAL);
+
+    sup1->reset_queueing_stats();
+    sup2->reset_queueing_stats();
+    pinger->pings_left = 10;
+    pinger->pong_received = 0;
+    pinger->send<ping_t>(pinger->ponger_addr);
+    sup1->do_process();
+    REQUIRE(pinger->pong_received == 10);
+
+    auto &stats1 = sup1->get_queueing_stats();
+    auto &stats2 = sup2->get_queueing_stats();
+#ifdef ROTOR_ENABLE_METRICS
+    if (enabled) {
+        /* the child supervisor inherits the option, the delays are recorded per destination supervisor */
+        auto pongs = stats1.get(r::message_t<pong_t>::message_type);
+        REQUIRE(pongs);
+        CHECK(pongs->count() == 10);
+        CHECK(!stats1.get(r::message_t<ping_t>::message_type));
+
+        auto pings = stats2.get(r::message_t<ping_t>::message_type);
+        REQUIRE(pings);
+        CHECK(pings->count() == 10);
+        CHECK(stats2.delay.count() == 10);
+        CHECK(stats2.delay.max() >= stats2.delay.min());
+
+        sup1->reset_queueing_stats();
+        CHECK(stats1.delay.count() == 0);
+        CHECK(stats1.per_type.empty());
+    }
+#else
+    enabled = false;
+#endif
+    if (!enabled) {
+        CHECK(stats1.delay.count() == 0);
+        CHECK(stats1.per_type.empty());
+        CHECK(stats2.delay.count() == 0);
+        CHECK(stats2.per_type.empty());
+    }
+
+    sup1->do_shutdown();
+    sup1->do_process();
+    CHECK(sup1->get_state() == r::state_t::SHUT_DOWN);
+}
@@ -0,0 +1,193 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "catch.hpp"
+#include "rotor.hpp"
+#include "supervisor_test.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+namespace r = rotor;
+namespace rt = r::test;
+
+using namespace std::chrono_literals;
+
+struct ping_t {};
+struct pong_t {};
+
+struct pinger_t : public r::actor_base_t {
+    std::uint32_t pings_left = 10;
+    std::uint32_t pong_received = 0;
+
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&pinger_t::on_pong); });
+    }
+
+    void on_start() noexcept override {
+        r::actor_base_t::on_start();
+        send<ping_t>(ponger_addr);
+    }
+
+    void on_pong(r::message_t<pong_t> &) noexcept {
+        ++pong_received;
+        if (--pings_left) {
+            send<ping_t>(ponger_addr);
+        }
+    }
+
+    r::address_ptr_t ponger_addr;
+};
+
+struct ponger_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&ponger_t::on_ping); });
+    }
+
+    void on_ping(r::message_t<ping_t> &) noexcept { send<pong_t>(pinger_addr); }
+
+    r::address_ptr_t pinger_addr;
+};
+
+static std::size_t count(const std::string &haystack, const std::string &needle) {
+    std::size_t r = 0;
+    for (auto pos = haystack.find(needle); pos != std::string::npos; pos = haystack.find(needle, pos + 1)) {
+        ++r;
+    }
+    return r;
+}
+
+static std::string read(const std::string &path) {
+    std::ifstream in(path);
+    std::stringstream buff;
+    buff << in.rdbuf();
+    return buff.str();
+}
+
+/* the trace file in the temporary directory, removed upon the test completion */
+struct trace_file_t {
+    trace_file_t(const char *name) : path{(std::filesystem::temp_directory_path() / name).string()} {}
+    ~trace_file_t() { std::remove(path.c_str()); }
+    std::string path;
+};
+
+static void ping_pong(r::system_context_t &system_context) {
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto pinger = sup->create_actor<pinger_t>().timeout(rt::default_timeout).finish();
+    auto ponger = sup->create_actor<ponger_t>().timeout(rt::default_timeout).finish();
+    pinger->ponger_addr = ponger->get_address();
+    ponger->pinger_addr = pinger->get_address();
+
+    sup->do_process();
+    REQUIRE(pinger->pong_received == 10);
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+}
+
+TEST_CASE("trace ping-pong", "[tracer]") {
+    trace_file_t file("rotor-026-tracer.json");
+    auto &path = file.path;
+    r::system_context_t system_context;
+    auto tracer = r::tracer_ptr_t(new r::tracer_t(path));
+    REQUIRE(tracer->good());
+    system_context.set_tracer(tracer);
+
+    ping_pong(system_context);
+
+#ifdef ROTOR_ENABLE_TRACING
+    CHECK(tracer->flush() > 0);
+    CHECK(tracer->flush() == 0);
+#endif
+    CHECK(tracer->get_dropped() == 0);
+    system_context.set_tracer(nullptr);
+    tracer.reset();
+
+    auto trace = read(path);
+    REQUIRE(trace.size() > 2);
+    CHECK(trace.front() == '[');
+    CHECK(trace.find("]") == trace.size() - 2);
+
+#ifdef ROTOR_ENABLE_TRACING
+    CHECK(count(trace, "\"name\":\"thread_name\"") == 1);
+    CHECK(count(trace, "\"cat\":\"enqueue\"") > 20);
+    CHECK(count(trace, "\"cat\":\"dispatch\"") == count(trace, "\"cat\":\"enqueue\""));
+    CHECK(count(trace, "\"ph\":\"B\"") == count(trace, "\"ph\":\"E\""));
+    CHECK(count(trace, "\"ph\":\"B\"") > 20);
+    CHECK(count(trace, "ping_t") >= 10 * 4);
+    CHECK(count(trace, "pong_t") >= 10 * 4);
+#endif
+}
+
+TEST_CASE("trace sampling", "[tracer]") {
+    trace_file_t file("rotor-026-tracer-sampled.json");
+    auto &path = file.path;
+    r::system_context_t system_context;
+    auto tracer = r::tracer_ptr_t(new r::tracer_t(path, 1000));
+    system_context.set_tracer(tracer);
+
+    ping_pong(system_context);
+
+    system_context.set_tracer(nullptr);
+    tracer.reset();
+
+    auto trace = read(path);
+#ifdef ROTOR_ENABLE_TRACING
+    CHECK(count(trace, "\"cat\":\"enqueue\"") == 1);
+#else
+    CHECK(count(trace, "\"cat\":\"enqueue\"") == 0);
+#endif
+}
+
+TEST_CASE("trace ring overflow", "[tracer]") {
+    trace_file_t file("rotor-026-tracer-overflow.json");
+    auto &path = file.path;
+    r::system_context_t system_context;
+    auto tracer = r::tracer_ptr_t(new r::tracer_t(path, 1, 4));
+    system_context.set_tracer(tracer);
+
+    ping_pong(system_context);
+
+#ifdef ROTOR_ENABLE_TRACING
+    CHECK(tracer->get_dropped() > 0);
+    CHECK(tracer->flush() == 4);
+#endif
+    system_context.set_tracer(nullptr);
+}
+
+TEST_CASE("trace is flushed periodically", "[tracer]") {
+    trace_file_t file("rotor-026-tracer-periodic.json");
+    auto &path = file.path;
+    r::system_context_t system_context;
+    auto tracer = r::tracer_ptr_t(new r::tracer_t(path));
+    REQUIRE(!tracer->start(1ms));
+    system_context.set_tracer(tracer);
+
+    ping_pong(system_context);
+
+#ifdef ROTOR_ENABLE_TRACING
+    auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (count(read(path), "\"cat\":\"enqueue\"") <= 20 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(1ms);
+    }
+    CHECK(count(read(path), "\"cat\":\"enqueue\"") > 20);
+#endif
+    system_context.set_tracer(nullptr);
+    tracer.reset();
+
+    auto trace = read(path);
+    CHECK(trace.front() == '[');
+    CHECK(trace.find("]") == trace.size() - 2);
+}
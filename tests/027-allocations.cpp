@@ -0,0 +1,230 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "catch.hpp"
+#include "rotor.hpp"
+#include "supervisor_test.h"
+#include "allocations.h"
+
+namespace r = rotor;
+namespace rt = r::test;
+
+/* The upper bounds below are the allocations of the current implementation
+ * in the steady state (i.e. after warm-up), they should not grow. */
+
+static constexpr std::size_t batch = 1000;
+
+struct ping_t {};
+
+struct payload_t {
+    using response_t = int;
+    int value;
+};
+
+using request_t = r::request_traits_t<payload_t>::request::message_t;
+using response_t = r::request_traits_t<payload_t>::response::message_t;
+
+struct sender_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) {
+            p.subscribe_actor(&sender_t::on_ping);
+            p.subscribe_actor(&sender_t::on_request);
+            p.subscribe_actor(&sender_t::on_response);
+        });
+    }
+
+    void on_ping(r::message_t<ping_t> &) noexcept {
+        ++received;
+        if (pings_left) {
+            --pings_left;
+            send<ping_t>(address);
+        }
+    }
+
+    void on_request(request_t &message) noexcept { reply_to(message, message.payload.request_payload.value); }
+
+    void on_response(response_t &message) noexcept {
+        if (!message.payload.ec) {
+            ++received;
+        }
+        if (requests_left) {
+            --requests_left;
+            request<payload_t>(address, 1).send(rt::default_timeout);
+        }
+    }
+
+    void pings(std::size_t count) noexcept {
+        pings_left = count - 1;
+        send<ping_t>(address);
+    }
+
+    void requests(std::size_t count) noexcept {
+        requests_left = count - 1;
+        request<payload_t>(address, 1).send(rt::default_timeout);
+    }
+
+    std::size_t pings_left = 0;
+    std::size_t requests_left = 0;
+    std::size_t received = 0;
+};
+
+struct pooled_sender_t : public sender_t, r::pool_allocated_t {
+    using sender_t::sender_t;
+};
+
+TEST_CASE("make_message & wrap_handler", "[allocations]") {
+    r::system_context_t system_context;
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto actor = sup->create_actor<sender_t>().timeout(rt::default_timeout).finish();
+    sup->do_process();
+
+    SECTION("make_message") {
+        rt::allocations_phase_t phase;
+        auto message = r::make_message<ping_t>(actor->get_address());
+        auto allocations = phase.get();
+        CHECK(allocations.allocations == 1);
+        CHECK(allocations.bytes == sizeof(r::message_t<ping_t>));
+    }
+
+    SECTION("wrap_handler") {
+        rt::allocations_phase_t phase;
+        auto handler = r::wrap_handler(*actor, &sender_t::on_ping);
+        auto allocations = phase.get();
+        CHECK(allocations.allocations == 1);
+        CHECK(allocations.bytes >= sizeof(r::handler_t<decltype(&sender_t::on_ping)>));
+    }
+
+    SECTION("lambda wrap_handler") {
+        rt::allocations_phase_t phase;
+        auto lambda = r::lambda<r::message_t<ping_t>>([](auto &) noexcept {});
+        auto handler = r::wrap_handler(*actor, std::move(lambda));
+        auto allocations = phase.get();
+        CHECK(allocations.allocations == 1);
+    }
+
+    SECTION("subscription points") {
+        auto handler = r::wrap_handler(*actor, &sender_t::on_ping);
+        auto point = r::subscription_point_t(handler, actor->get_address());
+        rt::allocations_phase_t phase;
+        r::subscription_points_t points;
+        points.emplace_back(point);
+        CHECK(points.size() == 1);
+        CHECK(phase.get().allocations == 0);
+        points.emplace_back(point);
+        points.emplace_back(point);
+        CHECK(points.size() == 3);
+        CHECK(std::distance(points.begin(), points.end()) == 3);
+        CHECK(phase.get().allocations > 0);
+        points.clear();
+        CHECK(points.empty());
+    }
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+}
+
+TEST_CASE("per delivered message", "[allocations]") {
+    r::system_context_t system_context;
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto actor = sup->create_actor<sender_t>().timeout(rt::default_timeout).finish();
+    sup->do_process();
+
+    actor->pings(batch);
+    sup->do_process();
+    REQUIRE(actor->received == batch);
+
+    rt::allocations_phase_t phase;
+    actor->pings(batch);
+    sup->do_process();
+    auto allocations = phase.get();
+    REQUIRE(actor->received == batch * 2);
+    INFO("per " << batch << " messages: " << allocations.allocations << " allocations, " << allocations.bytes
+                << " bytes");
+
+    /* the message itself, plus amortized messages queue chunks */
+    CHECK(allocations.allocations <= batch + batch / 32);
+    CHECK(allocations.bytes <= batch * sizeof(r::message_t<ping_t>) + (batch / 32) * 512);
+    CHECK(allocations.allocations == allocations.deallocations);
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+}
+
+TEST_CASE("per request", "[allocations]") {
+    r::system_context_t system_context;
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto actor = sup->create_actor<sender_t>().timeout(rt::default_timeout).finish();
+    sup->do_process();
+
+    actor->requests(batch);
+    sup->do_process();
+    REQUIRE(actor->received == batch);
+
+    rt::allocations_phase_t phase;
+    actor->requests(batch);
+    sup->do_process();
+    auto allocations = phase.get();
+    REQUIRE(actor->received == batch * 2);
+    INFO("per " << batch << " requests: " << allocations.allocations << " allocations, " << allocations.bytes
+                << " bytes");
+
+    /* request and response messages, request bookkeeping and timeout timer,
+     * plus amortized messages queue chunks */
+    CHECK(allocations.allocations <= batch * 7 + batch / 8);
+    CHECK(allocations.allocations == allocations.deallocations);
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+}
+
+TEST_CASE("per spawned actor", "[allocations]") {
+    r::system_context_t system_context;
+    bool pool = GENERATE(false, true);
+    auto sup =
+        system_context.create_supervisor<rt::supervisor_test_t>().pool(pool).timeout(rt::default_timeout).finish();
+    sup->do_process();
+
+    std::vector<r::intrusive_ptr_t<sender_t>> actors;
+    actors.reserve(batch);
+    auto spawn = [&]() {
+        for (std::size_t i = 0; i < batch; ++i) {
+            if (pool) {
+                actors.emplace_back(sup->create_actor<pooled_sender_t>().timeout(rt::default_timeout).finish());
+            } else {
+                actors.emplace_back(sup->create_actor<sender_t>().timeout(rt::default_timeout).finish());
+            }
+        }
+        sup->do_process();
+        REQUIRE(sup->get_children_count() == batch + 1);
+        for (auto &actor : actors) {
+            actor->do_shutdown();
+        }
+        actors.clear();
+        sup->do_process();
+        REQUIRE(sup->get_children_count() == 1);
+    };
+    spawn();
+
+    rt::allocations_phase_t phase;
+    spawn();
+    auto allocations = phase.get();
+    INFO("per " << batch << " actors" << (pool ? " (pooled)" : "") << ": " << allocations.allocations
+                << " allocations, " << allocations.bytes << " bytes");
+
+    /* mostly init/start/shutdown messages and plugins bookkeeping */
+    CHECK(allocations.allocations <= batch * (pool ? 100 : 104));
+    CHECK(allocations.allocations >= allocations.deallocations);
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+}
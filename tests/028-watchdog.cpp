@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "catch.hpp"
+#include "rotor.hpp"
+#include "supervisor_test.h"
+#include <mutex>
+#include <thread>
+
+namespace r = rotor;
+namespace rt = r::test;
+
+using namespace std::chrono_literals;
+
+struct fast_t {};
+struct slow_t {};
+
+struct sample_actor_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) {
+            p.subscribe_actor(&sample_actor_t::on_fast);
+            p.subscribe_actor(&sample_actor_t::on_slow);
+        });
+    }
+
+    void on_fast(r::message_t<fast_t> &) noexcept { ++handled; }
+
+    void on_slow(r::message_t<slow_t> &) noexcept {
+        std::this_thread::sleep_for(150ms);
+        ++handled;
+    }
+
+    std::size_t handled = 0;
+};
+
+struct reports_t {
+    std::mutex mutex;
+    std::vector<r::slow_handler_t> items;
+
+    auto callback() {
+        return [this](const r::slow_handler_t &info) {
+            std::lock_guard<std::mutex> lock(mutex);
+            items.emplace_back(info);
+        };
+    }
+};
+
+TEST_CASE("slow handler detection", "[watchdog]") {
+    reports_t reports;
+    r::system_context_t system_context;
+    auto watchdog = r::watchdog_ptr_t(new r::watchdog_t(30ms, reports.callback(), 5ms));
+    REQUIRE(!watchdog->start());
+    system_context.set_watchdog(watchdog);
+
+    auto sup = system_context.create_supervisor<rt::supervisor_test_t>().timeout(rt::default_timeout).finish();
+    auto actor = sup->create_actor<sample_actor_t>().timeout(rt::default_timeout).finish();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::OPERATIONAL);
+
+    for (int i = 0; i < 100; ++i) {
+        actor->send<fast_t>(actor->get_address());
+    }
+    sup->do_process();
+    std::this_thread::sleep_for(50ms);
+    CHECK(actor->handled == 100);
+    CHECK(watchdog->get_detected() == 0);
+
+    actor->send<slow_t>(actor->get_address());
+    sup->do_process();
+    CHECK(actor->handled == 101);
+
+#ifdef ROTOR_ENABLE_WATCHDOG
+    CHECK(watchdog->get_detected() == 1);
+    std::lock_guard<std::mutex> lock(reports.mutex);
+    REQUIRE(reports.items.size() == 1);
+    auto &info = reports.items.front();
+    CHECK(info.address == actor->get_address().get());
+    CHECK(info.message_type == r::message_t<slow_t>::message_type);
+    CHECK(info.duration >= 30ms);
+    CHECK(info.duration < 150ms);
+    auto description = info.to_string();
+    CHECK(description.find("slow_t") != std::string::npos);
+    CHECK(description.find("sample_actor_t") != std::string::npos);
+#else
+    CHECK(watchdog->get_detected() == 0);
+#endif
+
+    sup->do_shutdown();
+    sup->do_process();
+    REQUIRE(sup->get_state() == r::state_t::SHUT_DOWN);
+}
+
+TEST_CASE("watchdog without supervisors", "[watchdog]") {
+    reports_t reports;
+    auto watchdog = r::watchdog_ptr_t(new r::watchdog_t(1ms, reports.callback()));
+    REQUIRE(!watchdog->start());
+    std::this_thread::sleep_for(5ms);
+    CHECK(watchdog->check() == 0);
+    CHECK(watchdog->get_detected() == 0);
+}
+
+TEST_CASE("watchdog slot is reused by the thread", "[watchdog]") {
+    reports_t reports;
+    auto watchdog_1 = r::watchdog_ptr_t(new r::watchdog_t(1s, reports.callback()));
+    auto watchdog_2 = r::watchdog_ptr_t(new r::watchdog_t(1s, reports.callback()));
+
+    auto slot_1 = watchdog_1->get_slot();
+    auto slot_2 = watchdog_2->get_slot();
+    CHECK(slot_1 != slot_2);
+    for (int i = 0; i < 10; ++i) {
+        CHECK(watchdog_1->get_slot() == slot_1);
+        CHECK(watchdog_2->get_slot() == slot_2);
+    }
+
+    r::details::watchdog_slot_t *other_slot = nullptr;
+    std::thread([&]() { other_slot = watchdog_1->get_slot(); }).join();
+    CHECK(other_slot != slot_1);
+    CHECK(other_slot->thread_id != slot_1->thread_id);
+    CHECK(watchdog_1->get_slot() == slot_1);
+}
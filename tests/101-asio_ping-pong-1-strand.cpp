@@ -99,3 +99,40 @@ TEST_CASE("ping/pong ", "[supervisor][asio]") {
     CHECK(sup->get_timers_map().size() == 0);
     CHECK(destroyed == 4);
 }
+
+TEST_CASE("ping/pong, single threaded", "[supervisor][asio]") {
+    destroyed = 0;
+    asio::io_context io_context{1};
+    auto system_context = ra::system_context_asio_t::ptr_t{new ra::system_context_asio_t(io_context)};
+    auto strand = std::make_shared<asio::io_context::strand>(io_context);
+    auto timeout = r::pt::milliseconds{10};
+    auto sup = system_context->create_supervisor<rt::supervisor_asio_test_t>()
+                   .timeout(timeout)
+                   .strand(strand)
+                   .single_threaded(true)
+                   .finish();
+
+    auto pinger = sup->create_actor<pinger_t>().timeout(timeout).finish();
+    auto ponger = sup->create_actor<ponger_t>().timeout(timeout).finish();
+    pinger->set_ponger_addr(static_cast<r::actor_base_t *>(ponger.get())->get_address());
+    ponger->set_pinger_addr(static_cast<r::actor_base_t *>(pinger.get())->get_address());
+
+    sup->start();
+    io_context.run();
+
+    REQUIRE(pinger->ping_sent == 1);
+    REQUIRE(pinger->pong_received == 1);
+    REQUIRE(ponger->pong_sent == 1);
+    REQUIRE(ponger->ping_received == 1);
+
+    REQUIRE(static_cast<r::actor_base_t *>(sup.get())->access<rt::to::state>() == r::state_t::SHUT_DOWN);
+    REQUIRE(sup->get_leader_queue().size() == 0);
+    CHECK(rt::empty(sup->get_subscription()));
+
+    pinger.reset();
+    ponger.reset();
+
+    io_context.run();
+    CHECK(sup->get_timers_map().size() == 0);
+    CHECK(destroyed == 4);
+}
@@ -0,0 +1,95 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "catch.hpp"
+#include "rotor.hpp"
+#include "rotor/asio.hpp"
+#include "allocations.h"
+#include <chrono>
+
+namespace r = rotor;
+namespace ra = rotor::asio;
+namespace rt = rotor::test;
+namespace asio = boost::asio;
+
+TEST_CASE("memory blocks are recycled", "[asio]") {
+    ra::handler_allocator_t<char> allocator;
+    auto initial = r::details::pool_cached();
+
+    auto ptr_1 = allocator.allocate(100);
+    allocator.deallocate(ptr_1, 100);
+    CHECK(r::details::pool_cached() == initial + 1);
+
+    auto ptr_2 = allocator.allocate(110);
+    CHECK(ptr_1 == ptr_2);
+    CHECK(r::details::pool_cached() == initial);
+    allocator.deallocate(ptr_2, 110);
+
+    auto big = allocator.allocate(4096);
+    allocator.deallocate(big, 4096);
+    CHECK(r::details::pool_cached() == initial + 1);
+}
+
+TEST_CASE("deferred handlers use recycling allocator", "[asio]") {
+    asio::io_context io_context;
+    asio::io_context::strand strand(io_context);
+    int invocations = 0;
+
+    auto handler = ra::make_allocated_handler([&invocations]() { ++invocations; });
+    using allocator_t = asio::associated_allocator<decltype(handler)>::type;
+    CHECK(std::is_same_v<allocator_t, ra::handler_allocator_t<char>>);
+
+    asio::defer(strand, std::move(handler));
+    io_context.run();
+    CHECK(invocations == 1);
+    auto warmed_up = r::details::pool_cached();
+    CHECK(warmed_up > 0);
+
+    for (int i = 0; i < 10; ++i) {
+        asio::defer(strand, ra::make_allocated_handler([&invocations]() { ++invocations; }));
+        asio::defer(io_context, ra::make_allocated_handler([&invocations]() { ++invocations; }));
+    }
+    io_context.restart();
+    io_context.run();
+    CHECK(invocations == 21);
+    CHECK(r::details::pool_cached() >= warmed_up);
+}
+
+TEST_CASE("steady-state deferred and timer handlers do not allocate", "[asio]") {
+    asio::io_context io_context;
+    asio::io_context::strand strand(io_context);
+    asio::steady_timer timer(io_context);
+    int deferred = 0;
+    int fired = 0;
+
+    auto iterate = [&]() {
+        asio::defer(strand, ra::make_allocated_handler([&deferred]() { ++deferred; }));
+        asio::defer(io_context, ra::make_allocated_handler([&deferred]() { ++deferred; }));
+        timer.expires_after(std::chrono::nanoseconds(0));
+        timer.async_wait(ra::make_allocated_handler([&fired](const boost::system::error_code &ec) {
+            if (!ec) {
+                ++fired;
+            }
+        }));
+        io_context.restart();
+        io_context.run();
+    };
+
+    /* warm up asio internals and the recycling pool */
+    for (int i = 0; i < 10; ++i) {
+        iterate();
+    }
+
+    rt::allocations_phase_t phase;
+    for (int i = 0; i < 1000; ++i) {
+        iterate();
+    }
+    auto allocations = phase.get();
+    CHECK(deferred == 2 * 1010);
+    CHECK(fired == 1010);
+    CHECK(allocations.allocations == 0);
+    CHECK(allocations.deallocations == 0);
+}
@@ -0,0 +1,118 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "catch.hpp"
+#include "rotor.hpp"
+#include "rotor/ev.hpp"
+#include "access.h"
+#include <ev.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace r = rotor;
+namespace re = rotor::ev;
+namespace rt = r::test;
+
+static constexpr std::uint32_t producers_count = 4;
+static constexpr std::uint32_t shutdown_after = 20000;
+
+static std::atomic_bool started{false};
+static std::atomic_bool finished{false};
+static std::atomic_bool throttled{true};
+static std::atomic_uint32_t sent{0};
+static std::atomic_uint32_t destroyed_messages{0};
+static bool sup_destroyed = false;
+
+struct ping_t {
+    ~ping_t() { destroyed_messages.fetch_add(1, std::memory_order_relaxed); }
+};
+
+struct supervisor_ev_test_t : public re::supervisor_ev_t {
+    using re::supervisor_ev_t::supervisor_ev_t;
+
+    ~supervisor_ev_test_t() { sup_destroyed = true; }
+};
+
+struct counter_t : public r::actor_base_t {
+    std::uint32_t received = 0;
+
+    using r::actor_base_t::actor_base_t;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) { p.subscribe_actor(&counter_t::on_ping); });
+    }
+
+    void on_start() noexcept override {
+        r::actor_base_t::on_start();
+        started.store(true, std::memory_order_release);
+    }
+
+    void on_ping(r::message_t<ping_t> &) noexcept {
+        if (++received == shutdown_after) {
+            supervisor->shutdown();
+        }
+    }
+};
+
+TEST_CASE("foreign threads enqueue while the supervisor shuts down", "[supervisor][ev]") {
+    auto *loop = ev_loop_new(0);
+    auto system_context = re::system_context_ptr_t{new re::system_context_ev_t()};
+    auto timeout = r::pt::milliseconds{100};
+    auto sup = system_context->create_supervisor<supervisor_ev_test_t>()
+                   .loop(loop)
+                   .loop_ownership(true)
+                   .timeout(timeout)
+                   .finish();
+    auto counter = sup->create_actor<counter_t>().timeout(timeout).finish();
+    auto dest = counter->get_address();
+
+    std::vector<std::thread> producers;
+    for (std::uint32_t i = 0; i < producers_count; ++i) {
+        producers.emplace_back([&sup, dest]() {
+            while (!started.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            while (!finished.load(std::memory_order_acquire)) {
+                /* do not let the inbound queue grow unbounded while the supervisor is running */
+                if (throttled.load(std::memory_order_acquire) &&
+                    sent.load(std::memory_order_relaxed) - destroyed_messages.load(std::memory_order_relaxed) > 1000) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                sup->enqueue(r::make_message<ping_t>(dest));
+                sent.fetch_add(1, std::memory_order_release);
+            }
+        });
+    }
+
+    sup->start();
+    ev_run(loop);
+
+    /* let the producers enqueue to the shut down supervisor */
+    auto sent_at_shutdown = sent.load(std::memory_order_acquire);
+    throttled.store(false, std::memory_order_release);
+    while (sent.load(std::memory_order_acquire) < sent_at_shutdown + 1000) {
+        std::this_thread::yield();
+    }
+    finished.store(true, std::memory_order_release);
+    for (auto &thread : producers) {
+        thread.join();
+    }
+
+    CHECK(counter->received >= shutdown_after);
+    CHECK(counter->received <= sent_at_shutdown);
+    CHECK(static_cast<r::actor_base_t *>(sup.get())->access<rt::to::state>() == r::state_t::SHUT_DOWN);
+
+    counter.reset();
+    dest.reset();
+    sup.reset();
+    system_context.reset();
+
+    CHECK(sup_destroyed);
+    CHECK(destroyed_messages.load() == sent.load());
+}
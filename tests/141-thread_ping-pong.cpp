@@ -144,6 +144,12 @@ TEST_CASE("ping/pong", "[supervisor][ev]") {
     REQUIRE(ponger->pong_sent == 1);
     REQUIRE(ponger->ping_received == 1);
 
+#ifdef ROTOR_ENABLE_METRICS
+    auto stats = sup->get_stats();
+    CHECK(stats.processed > 0);
+    CHECK(stats.inbound_high_water > 0);
+#endif
+
     pinger.reset();
     ponger.reset();
 
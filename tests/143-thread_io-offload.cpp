@@ -0,0 +1,163 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "catch.hpp"
+#include "rotor.hpp"
+#include "rotor/thread.hpp"
+#include "access.h"
+#include <atomic>
+
+namespace r = rotor;
+namespace rth = rotor::thread;
+namespace rt = r::test;
+
+struct work_t {
+    std::uint32_t value;
+};
+
+struct result_t {
+    std::uint32_t value;
+    std::thread::id executor;
+};
+
+struct tick_t {};
+
+struct worker_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    std::uint32_t total = 0;
+    std::uint32_t results = 0;
+    std::uint32_t ticks = 0;
+    std::uint32_t jobs = 4;
+    std::thread::id owner;
+    bool offloaded = true;
+    std::atomic_bool unblocked{false};
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) {
+            p.subscribe_actor(&worker_t::on_work)->tag_io_offload();
+            p.subscribe_actor(&worker_t::on_result);
+            p.subscribe_actor(&worker_t::on_tick);
+        });
+    }
+
+    void on_start() noexcept override {
+        r::actor_base_t::on_start();
+        owner = std::this_thread::get_id();
+        for (std::uint32_t i = 1; i <= jobs; ++i) {
+            send<work_t>(address, i);
+        }
+        send<tick_t>(address);
+    }
+
+    // executed on I/O thread pool, it is blocked until the actor thread processes tick
+    void on_work(r::message_t<work_t> &msg) noexcept {
+        while (!unblocked) {
+            std::this_thread::yield();
+        }
+        supervisor->enqueue(r::make_message<result_t>(address, msg.payload.value * 2, std::this_thread::get_id()));
+    }
+
+    void on_tick(r::message_t<tick_t> &) noexcept {
+        ++ticks;
+        unblocked = true;
+    }
+
+    void on_result(r::message_t<result_t> &msg) noexcept {
+        total += msg.payload.value;
+        offloaded = offloaded && (msg.payload.executor != owner);
+        if (++results == jobs) {
+            supervisor->do_shutdown();
+        }
+    }
+};
+
+TEST_CASE("io-tagged handlers are offloaded", "[supervisor][thread]") {
+    auto system_context = r::intrusive_ptr_t<rth::system_context_thread_t>(new rth::system_context_thread_t(2));
+    auto timeout = r::pt::milliseconds{100};
+    auto sup = system_context->create_supervisor<rth::supervisor_thread_t>().timeout(timeout).finish();
+    auto worker = sup->create_actor<worker_t>().timeout(timeout).finish();
+#ifdef ROTOR_REFCOUNT_THREADUNSAFE
+    worker->unblocked = true;
+#endif
+
+    sup->start();
+    system_context->run();
+
+    CHECK(worker->ticks == 1);
+    CHECK(worker->results == 4);
+    CHECK(worker->total == 2 + 4 + 6 + 8);
+#ifndef ROTOR_REFCOUNT_THREADUNSAFE
+    CHECK(worker->offloaded);
+#else
+    CHECK(!worker->offloaded);
+#endif
+    CHECK(worker->access<rt::to::state>() == r::state_t::SHUT_DOWN);
+    CHECK(static_cast<r::actor_base_t *>(sup.get())->access<rt::to::state>() == r::state_t::SHUT_DOWN);
+}
+
+TEST_CASE("io-tagged handlers are executed inline, when pool is saturated", "[supervisor][thread]") {
+    auto system_context = r::intrusive_ptr_t<rth::system_context_thread_t>(new rth::system_context_thread_t(1, 0));
+    auto timeout = r::pt::milliseconds{100};
+    auto sup = system_context->create_supervisor<rth::supervisor_thread_t>().timeout(timeout).finish();
+    auto worker = sup->create_actor<worker_t>().timeout(timeout).finish();
+    worker->unblocked = true;
+
+    sup->start();
+    system_context->run();
+
+    CHECK(worker->results == 4);
+    CHECK(worker->total == 2 + 4 + 6 + 8);
+    CHECK(!worker->offloaded);
+    CHECK(static_cast<r::actor_base_t *>(sup.get())->access<rt::to::state>() == r::state_t::SHUT_DOWN);
+}
+
+struct sender_t : public r::actor_base_t {
+    using r::actor_base_t::actor_base_t;
+
+    std::thread::id owner;
+    std::thread::id executor;
+    std::uint32_t results = 0;
+
+    void configure(r::plugin::plugin_base_t &plugin) noexcept override {
+        r::actor_base_t::configure(plugin);
+        plugin.with_casted<r::plugin::starter_plugin_t>([](auto &p) {
+            p.subscribe_actor(&sender_t::on_work)->tag_io();
+            p.subscribe_actor(&sender_t::on_result);
+        });
+    }
+
+    void on_start() noexcept override {
+        r::actor_base_t::on_start();
+        owner = std::this_thread::get_id();
+        send<work_t>(address, 1u);
+    }
+
+    void on_work(r::message_t<work_t> &msg) noexcept {
+        executor = std::this_thread::get_id();
+        send<result_t>(address, msg.payload.value * 2, executor);
+    }
+
+    void on_result(r::message_t<result_t> &) noexcept {
+        ++results;
+        supervisor->do_shutdown();
+    }
+};
+
+TEST_CASE("io-tagged handlers, which may send, are not offloaded", "[supervisor][thread]") {
+    auto system_context = r::intrusive_ptr_t<rth::system_context_thread_t>(new rth::system_context_thread_t(2));
+    auto timeout = r::pt::milliseconds{100};
+    auto sup = system_context->create_supervisor<rth::supervisor_thread_t>().timeout(timeout).finish();
+    auto actor = sup->create_actor<sender_t>().timeout(timeout).finish();
+
+    sup->start();
+    system_context->run();
+
+    CHECK(actor->results == 1);
+    CHECK(actor->executor == actor->owner);
+    CHECK(static_cast<r::actor_base_t *>(sup.get())->access<rt::to::state>() == r::state_t::SHUT_DOWN);
+}
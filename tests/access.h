@@ -33,6 +33,7 @@ struct discovery_map {};
 struct forget_link {};
 struct tag {};
 struct timers_map {};
+struct address_mapping {};
 } // namespace to
 } // namespace
 
@@ -45,6 +46,7 @@ namespace rotor {
 template <> inline auto &actor_base_t::access<test::to::timers_map>() noexcept { return timers_map; }
 template <> inline auto &actor_base_t::access<test::to::state>() noexcept { return state; }
 template <> inline auto &actor_base_t::access<test::to::resources>() noexcept { return resources; }
+template <> inline auto &actor_base_t::access<test::to::address_mapping>() noexcept { return address_mapping; }
 
 template <> inline auto rotor::actor_base_t::access<test::to::get_plugin, const void *>(const void *identity) noexcept {
     return get_plugin(identity);
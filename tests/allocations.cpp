@@ -0,0 +1,44 @@
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include "allocations.h"
+#include <cstdlib>
+#include <new>
+
+using namespace rotor::test;
+
+namespace {
+thread_local allocations_t counters;
+
+/* the block size is stored in front of the user memory */
+constexpr std::size_t header_size = alignof(std::max_align_t);
+} // namespace
+
+allocations_t allocations_t::current() noexcept { return counters; }
+
+/* the rest of the global allocation functions (array, nothrow) are implemented
+ * by the standard library in terms of these */
+void *operator new(std::size_t size) {
+    auto ptr = static_cast<char *>(std::malloc(size + header_size));
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    *reinterpret_cast<std::size_t *>(ptr) = size;
+    ++counters.allocations;
+    counters.bytes += size;
+    return ptr + header_size;
+}
+
+void operator delete(void *ptr) noexcept {
+    if (ptr) {
+        auto block = static_cast<char *>(ptr) - header_size;
+        ++counters.deallocations;
+        counters.deallocated_bytes += *reinterpret_cast<std::size_t *>(block);
+        std::free(block);
+    }
+}
+
+void operator delete(void *ptr, std::size_t) noexcept { operator delete(ptr); }
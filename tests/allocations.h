@@ -0,0 +1,47 @@
+#pragma once
+
+//
+// Copyright (c) 2019-2020 Ivan Baidakou (basiliscos) (the dot dmol at gmail dot com)
+//
+// Distributed under the MIT Software License
+//
+
+#include <cstddef>
+
+namespace rotor {
+namespace test {
+
+/* heap allocations accounting; the counters are updated by the replaced global
+ * `operator new` / `operator delete` (see allocations.cpp, which should be linked
+ * into the executable) and are per-thread, so only the allocations made by the
+ * current thread are accounted */
+struct allocations_t {
+    std::size_t allocations = 0;
+    std::size_t deallocations = 0;
+    std::size_t bytes = 0;
+    std::size_t deallocated_bytes = 0;
+
+    allocations_t operator-(const allocations_t &other) const noexcept {
+        return allocations_t{allocations - other.allocations, deallocations - other.deallocations,
+                             bytes - other.bytes, deallocated_bytes - other.deallocated_bytes};
+    }
+
+    /* the amount of allocated and not yet deallocated blocks and bytes */
+    std::size_t live_blocks() const noexcept { return allocations - deallocations; }
+    std::size_t live_bytes() const noexcept { return bytes - deallocated_bytes; }
+
+    /* the current thread totals */
+    static allocations_t current() noexcept;
+};
+
+/* counts the allocations since the phase start */
+struct allocations_phase_t {
+    allocations_phase_t() noexcept : started{allocations_t::current()} {}
+
+    allocations_t get() const noexcept { return allocations_t::current() - started; }
+
+    allocations_t started;
+};
+
+} // namespace test
+} // namespace rotor